@@ -0,0 +1,170 @@
+#ifndef BORUVKA_PARALLEL_MST_H
+#define BORUVKA_PARALLEL_MST_H
+
+#include <algorithm>  // std::move
+#include <atomic>     // std::atomic, std::memory_order_relaxed
+#include <limits>     // std::numeric_limits
+#include <numeric>    // std::iota
+#include <utility>    // std::pair
+#include <vector>     // std::vector
+
+#include "DisjointSetConcurrent.h"
+#include "Edge.h"
+#include "edge_vector.h"
+#include "parallel_for.h"
+
+namespace detail {
+
+    // value of the lightest outgoing edge of a component that doesn't have one
+    constexpr std::size_t boruvka_no_edge = std::numeric_limits<std::size_t>::max();
+
+    // true iff edges[i] is lighter than edges[j]. Ties are broken by index, so the edges are
+    // strictly ordered and the lightest outgoing edges of the components can't close a cycle
+    template <typename Label, typename Weight>
+    [[nodiscard]] bool boruvka_lighter(const std::vector<Edge<Label, Weight>>& edges,
+                                       const std::size_t i, const std::size_t j) noexcept {
+        return edges[i].weight < edges[j].weight ||
+               (edges[i].weight == edges[j].weight && i < j);
+    }
+
+    // make edges[i] the lightest outgoing edge of a component if it's lighter than the current
+    // one. Safe to call concurrently on the same component
+    template <typename Label, typename Weight>
+    void boruvka_offer(std::atomic<std::size_t>& lightest,
+                       const std::vector<Edge<Label, Weight>>& edges,
+                       const std::size_t i) noexcept {
+        auto current = lightest.load(std::memory_order_relaxed);
+
+        // on failure compare_exchange_weak reloads current
+        while (current == boruvka_no_edge || boruvka_lighter(edges, i, current)) {
+            if (lightest.compare_exchange_weak(current, i, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+}  // namespace detail
+
+/**
+ * Parallel Boruvka algorithm. Every round finds the lightest outgoing edge of every component,
+ * scanning the edges with n_threads threads, adds those edges to the MST and contracts the
+ * components they connect through a concurrent Disjoint-Set. The edges that become internal to
+ * a component are then dropped. Every step runs in parallel.
+ * The number of components at least halves every round.
+ * n_threads equal to 0 means one thread for every hardware thread.
+ * Time:  O((m + n)log(n)/p) expected with p threads
+ * Space: O(n + m)
+ */
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+auto boruvka_parallel_mst(Graph<Label, Weight>&& graph, const std::size_t n_threads) noexcept
+    -> std::vector<Edge<Label, Weight>> {
+    // this vector will store the Minimum Spanning Tree
+    std::vector<Edge<Label, Weight>> mst;
+    const size_t n = graph.vertexes_size();
+    const size_t n_stop = n - 1;
+    mst.reserve(n_stop);
+
+    const auto threads = resolve_thread_count(n_threads);
+
+    // the edges that are internal to a component are removed in place after every round
+    auto edges = get_edge_vector(graph);
+
+    /**
+     * Create a new Disjoint-Set data structure to store the vertexes.
+     * Initially, every vertex is in a separate set.
+     * The threads contract the components concurrently.
+     */
+    disjoint_set::DisjointSetConcurrent<Label> disjoint_set(graph.get_vertexes());
+
+    // component[v] -> representative of the component of v at the beginning of the round. It
+    // doesn't change while the components are contracted, unlike the roots of the Disjoint-Set
+    std::vector<Label> component(n);
+    std::iota(component.begin(), component.end(), Label(0));
+
+    // lightest[c] -> index in edges of the lightest outgoing edge of the component c
+    std::vector<std::atomic<std::size_t>> lightest(n);
+
+    // added[chunk] -> MST edges added by the chunk in the current round
+    std::vector<std::vector<Edge<Label, Weight>>> added(threads);
+
+    // kept[chunk] -> range of edges of the chunk left after dropping the internal edges
+    std::vector<std::pair<std::size_t, std::size_t>> kept(threads);
+
+    // forget the lightest outgoing edges of the previous round
+    const auto reset_lightest = [&](const std::size_t first, const std::size_t last, std::size_t) {
+        for (auto c = first; c < last; ++c) {
+            lightest[c].store(detail::boruvka_no_edge, std::memory_order_relaxed);
+        }
+    };
+
+    // every edge left connects 2 different components, and it's offered to both of them
+    const auto find_lightest = [&](const std::size_t first, const std::size_t last, std::size_t) {
+        for (auto i = first; i < last; ++i) {
+            detail::boruvka_offer(lightest[component[edges[i].from]], edges, i);
+            detail::boruvka_offer(lightest[component[edges[i].to]], edges, i);
+        }
+    };
+
+    // link every component to the one at the other end of its lightest outgoing edge. 2
+    // components may select the same edge, but only one of them unites the 2 sets
+    const auto contract = [&](const std::size_t first, const std::size_t last,
+                              const std::size_t chunk) {
+        for (auto c = first; c < last; ++c) {
+            const auto i = lightest[c].load(std::memory_order_relaxed);
+            if (i == detail::boruvka_no_edge) {
+                continue;
+            }
+
+            if (disjoint_set.try_unite(edges[i].from, edges[i].to)) {
+                added[chunk].push_back(edges[i]);
+            }
+        }
+    };
+
+    const auto relabel = [&](const std::size_t first, const std::size_t last, std::size_t) {
+        for (auto v = first; v < last; ++v) {
+            component[v] = disjoint_set.find(v);
+        }
+    };
+
+    // move the edges of a chunk that connect 2 different components to the front of the chunk
+    const auto drop_internal = [&](const std::size_t first, const std::size_t last,
+                                   const std::size_t chunk) {
+        auto out = first;
+        for (auto i = first; i < last; ++i) {
+            if (component[edges[i].from] != component[edges[i].to]) {
+                edges[out++] = edges[i];
+            }
+        }
+        kept[chunk] = {first, out};
+    };
+
+    while (!edges.empty() && mst.size() < n_stop) {
+        parallel_for(n, threads, reset_lightest);
+        parallel_for(edges.size(), threads, find_lightest);
+
+        // only the representatives of the components have a lightest outgoing edge
+        const auto n_contracted = parallel_for(n, threads, contract);
+        for (size_t chunk = 0; chunk < n_contracted; ++chunk) {
+            mst.insert(mst.end(), added[chunk].cbegin(), added[chunk].cend());
+            added[chunk].clear();
+        }
+
+        parallel_for(n, threads, relabel);
+
+        // drop the edges that are now internal to a component, then join the chunks
+        const auto n_chunks = parallel_for(edges.size(), threads, drop_internal);
+
+        size_t size = kept[0].second;
+        for (size_t chunk = 1; chunk < n_chunks; ++chunk) {
+            const auto [first, last] = kept[chunk];
+            std::move(edges.begin() + first, edges.begin() + last, edges.begin() + size);
+            size += last - first;
+        }
+        edges.resize(size);
+    }
+
+    return mst;
+}
+
+#endif  // BORUVKA_PARALLEL_MST_H
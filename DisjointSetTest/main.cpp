@@ -0,0 +1,134 @@
+#include <iostream>  // std::cout, std::cerr
+#include <random>    // std::mt19937, std::uniform_int_distribution
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+#include "BasicDisjointSet.h"
+#include "DisjointSetFlat.h"
+
+namespace detail {
+
+    // number of random Disjoint-Sets checked for every implementation, and their maximum size
+    constexpr std::size_t disjoint_set_rounds = 200;
+    constexpr std::size_t disjoint_set_max_size = 200;
+
+    /**
+     * Check DS against a brute-force partition, in which every element stores the label of its
+     * set, on random sequences of try_unite and find. try_unite must return true iff the 2 sets
+     * were distinct, and 2 elements must have the same root iff they are in the same set.
+     * Return true iff every check succeeded, otherwise report the first failure on stderr.
+     * Time: O(r*n^2), where r is disjoint_set_rounds and n is disjoint_set_max_size
+     */
+    template <class DS>
+    bool check_disjoint_set(const std::string& name, std::mt19937& rng) {
+        using T = std::size_t;
+
+        for (std::size_t round = 0; round < disjoint_set_rounds; ++round) {
+            std::uniform_int_distribution<std::size_t> size(1, disjoint_set_max_size);
+            const auto n = size(rng);
+            std::uniform_int_distribution<T> element(0, n - 1);
+
+            std::vector<T> x_list(n);
+            std::vector<std::size_t> labels(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                x_list[i] = i;
+                labels[i] = i;
+            }
+            DS disjoint_set(x_list);
+
+            const auto fail = [&name, &round](const char* what) {
+                std::cerr << name << ": " << what << " in round " << round << std::endl;
+                return false;
+            };
+
+            for (std::size_t op = 0; op < 4 * n; ++op) {
+                const auto x = element(rng);
+                const auto y = element(rng);
+                const bool distinct = labels[x] != labels[y];
+
+                if (op % 2 == 0) {
+                    if (disjoint_set.try_unite(x, y) != distinct) {
+                        return fail("try_unite returned a wrong value");
+                    }
+
+                    // merge the set of y into the set of x
+                    const auto old_label = labels[y];
+                    for (auto& label : labels) {
+                        if (label == old_label) {
+                            label = labels[x];
+                        }
+                    }
+                } else if ((disjoint_set.find(x) == disjoint_set.find(y)) == distinct) {
+                    return fail("find disagrees with the partition");
+                }
+            }
+
+            // every set has exactly one root, and distinct sets have distinct roots
+            constexpr auto none = static_cast<std::size_t>(-1);
+            std::vector<std::size_t> root_of_label(n, none);
+            std::vector<std::size_t> label_of_root(n, none);
+            for (T x = 0; x < n; ++x) {
+                const auto root = disjoint_set.find(x);
+                if (root >= n) {
+                    return fail("find returned an out of range root");
+                }
+
+                if (root_of_label[labels[x]] == none) {
+                    root_of_label[labels[x]] = root;
+                }
+                if (label_of_root[root] == none) {
+                    label_of_root[root] = labels[x];
+                }
+
+                if (root_of_label[labels[x]] != root || label_of_root[root] != labels[x]) {
+                    return fail("the roots disagree with the partition");
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // check BasicDisjointSet with the linking rule Link and every compression rule. Return the
+    // number of failed combinations
+    template <class Link>
+    std::size_t check_link(const std::string& link_name, std::mt19937& rng) {
+        using namespace disjoint_set;
+        using T = std::size_t;
+
+        std::size_t n_failed = 0;
+        n_failed += !check_disjoint_set<BasicDisjointSet<T, Link, compress_none>>(
+            link_name + ", compress_none", rng);
+        n_failed += !check_disjoint_set<BasicDisjointSet<T, Link, compress_full>>(
+            link_name + ", compress_full", rng);
+        n_failed += !check_disjoint_set<BasicDisjointSet<T, Link, compress_halving>>(
+            link_name + ", compress_halving", rng);
+        n_failed += !check_disjoint_set<BasicDisjointSet<T, Link, compress_splitting>>(
+            link_name + ", compress_splitting", rng);
+        return n_failed;
+    }
+
+}  // namespace detail
+
+/**
+ * Check every combination of linking rule and compression rule of BasicDisjointSet, and
+ * DisjointSetFlat, against a brute-force partition on random sequences of operations.
+ * Usage: DisjointSetTest
+ * The exit status is 0 iff every check succeeded.
+ */
+int main() {
+    // fixed seed, so that a failure can be reproduced
+    std::mt19937 rng(42);
+
+    constexpr std::size_t n_tests = 13;
+    std::size_t n_failed = 0;
+    n_failed += detail::check_link<disjoint_set::link_by_size>("link_by_size", rng);
+    n_failed += detail::check_link<disjoint_set::link_by_rank>("link_by_rank", rng);
+    n_failed += detail::check_link<disjoint_set::link_by_index>("link_by_index", rng);
+    n_failed += !detail::check_disjoint_set<disjoint_set::DisjointSetFlat<std::size_t>>(
+        "DisjointSetFlat", rng);
+
+    std::cout << "Executed " << n_tests << " tests, " << n_tests - n_failed << " succeeded and "
+              << n_failed << " failed." << std::endl;
+    return n_failed == 0 ? 0 : 1;
+}
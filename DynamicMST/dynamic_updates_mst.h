@@ -0,0 +1,53 @@
+#ifndef DYNAMIC_UPDATES_MST_H
+#define DYNAMIC_UPDATES_MST_H
+
+#include <vector>  // std::vector
+
+#include "DynamicMST.h"
+#include "Edge.h"
+#include "edge_vector.h"
+
+namespace detail {
+
+    // one edge every dynamic_updates_stride is updated after the graph has been loaded
+    constexpr std::size_t dynamic_updates_stride = 8;
+
+    // amount added to the weight of the updated edges while they are heavier
+    constexpr long dynamic_updates_delta = 100000;
+
+}  // namespace detail
+
+/**
+ * Compute the MST inserting the edges of the graph into a DynamicMST, then apply a sequence of
+ * updates to one edge every detail::dynamic_updates_stride: its weight is increased, the edge is
+ * removed, inserted again with the increased weight, and finally restored to its original
+ * weight. The final graph is the original one, so the final forest is its MST, reached without
+ * ever recomputing it from scratch.
+ * Time:  O(mlogn) for the insertions, plus O(s + d + logn) for every update of a tree edge (see
+ *        DynamicMST)
+ * Space: O(m)
+ */
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+auto dynamic_updates_mst(Graph<Label, Weight>&& graph) -> std::vector<Edge<Label, Weight>> {
+    const auto edges = get_edge_vector(graph);
+
+    DynamicMST<Label, Weight> mst(graph.vertexes_size());
+    for (const auto& edge : edges) {
+        mst.insert(edge);
+    }
+
+    for (std::size_t i = 0; i < edges.size(); i += detail::dynamic_updates_stride) {
+        const auto& edge = edges[i];
+        const Edge<Label, Weight> heavier(
+            edge.from, edge.to, edge.weight + static_cast<Weight>(detail::dynamic_updates_delta));
+
+        mst.update_weight(heavier);
+        mst.erase(edge);
+        mst.insert(heavier);
+        mst.update_weight(edge);
+    }
+
+    return {mst.cbegin(), mst.cend()};
+}
+
+#endif  // DYNAMIC_UPDATES_MST_H
@@ -0,0 +1,33 @@
+#include <iostream>
+
+#include "BinaryGraphFile.h"
+#include "fast_edge_list_factory.h"
+
+/**
+ * Convert a graph from the text format to the binary graph format (see BinaryGraphFile.h).
+ * Usage: GraphConverter input-file output-file
+ * If input-file is "-", the text graph is read from stdin.
+ */
+int main(int argc, char* argv[]) {
+    typedef size_t Label;  // nodes are identified by size_t type
+    typedef long Weight;   // weights are of type long
+
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " input-file output-file" << std::endl;
+        return 1;
+    }
+
+    const std::string input_path = argv[1];
+    const std::string output_path = argv[2];
+
+    try {
+        // an empty path makes fast_edge_list_factory read from stdin
+        const auto [n, edge_list] =
+            fast_edge_list_factory<Label, Weight>(input_path == "-" ? "" : input_path);
+
+        binary_graph::write<Label, Weight>(output_path, n, edge_list);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef INCREMENTAL_BATCH_MST_H
+#define INCREMENTAL_BATCH_MST_H
+
+#include <algorithm>  // std::min
+#include <vector>     // std::vector
+
+#include "Edge.h"
+#include "IncrementalMST.h"
+#include "edge_vector.h"
+
+namespace detail {
+
+    // number of edges inserted in the IncrementalMST at once
+    constexpr std::size_t incremental_mst_batch_size = 1024;
+
+}  // namespace detail
+
+/**
+ * Compute the MST inserting the edges of the graph into an IncrementalMST in batches of
+ * detail::incremental_mst_batch_size edges, in the order in which the graph returns them, as if
+ * they arrived over time. The edges are never sorted.
+ * Time:  O(mlogn)
+ * Space: O(m)
+ */
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+auto incremental_batch_mst(Graph<Label, Weight>&& graph) -> std::vector<Edge<Label, Weight>> {
+    const auto edges = get_edge_vector(graph);
+
+    IncrementalMST<Label, Weight> mst(graph.vertexes_size());
+
+    for (std::size_t first = 0; first < edges.size();
+         first += detail::incremental_mst_batch_size) {
+        const auto last = std::min(first + detail::incremental_mst_batch_size, edges.size());
+        mst.insert(edges.cbegin() + first, edges.cbegin() + last);
+    }
+
+    return {mst.cbegin(), mst.cend()};
+}
+
+#endif  // INCREMENTAL_BATCH_MST_H
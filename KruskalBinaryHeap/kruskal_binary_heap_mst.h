@@ -0,0 +1,68 @@
+#ifndef KRUSKAL_BINARY_HEAP_MST_H
+#define KRUSKAL_BINARY_HEAP_MST_H
+
+#include <vector>  // std::vector
+
+#include "BinaryHeap.h"
+#include "DisjointSetFlat.h"
+#include "Edge.h"
+#include "edge_vector.h"
+
+namespace detail {
+
+    // comparison functor that turns heap::BinaryHeap into a Min Heap of edges ordered by weight
+    struct edge_weight_greater {
+        template <typename Label, typename Weight>
+        bool operator()(const Edge<Label, Weight>& l, const Edge<Label, Weight>& r) const noexcept {
+            return l.weight > r.weight;
+        }
+    };
+
+}  // namespace detail
+
+/**
+ * Kruskal algorithm that extracts the edges in non-decreasing order of weight from a Min Heap
+ * instead of sorting them. The heap is built in O(m), and the edges are popped only until the
+ * MST is complete, so the heavy edges that the MST doesn't need are never ordered.
+ * Time:  O(m + klogm), where k is the number of edges popped from the heap
+ * Space: O(m)
+ */
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+auto kruskal_binary_heap_mst(Graph<Label, Weight>&& graph) noexcept
+    -> std::vector<Edge<Label, Weight>> {
+    // this vector will store the Minimum Spanning Tree
+    std::vector<Edge<Label, Weight>> mst;
+    const size_t n_stop = graph.vertexes_size() - 1;
+    mst.reserve(n_stop);
+
+    // build a Min Heap of the edges ordered by weight in O(m) time
+    heap::BinaryHeap<Edge<Label, Weight>, false, detail::edge_weight_greater> min_heap(
+        get_edge_vector(graph));
+
+    // generate vector of vertexes in O(n) time
+    auto vertexes = graph.get_vertexes();
+
+    /**
+     * Create a new Disjoint-Set data structure to store the vertexes.
+     * Initially, every vertex is in a separate set.
+     * vertexes is no longer accessible after the process.
+     */
+    disjoint_set::DisjointSetFlat<Label> disjoint_set(std::move(vertexes));
+
+    // Pop the lightest edge until the heap is empty or the MST reached its maximum size
+    // (n - 1 edges). Every pop takes O(logm) time
+    while (!min_heap.empty() && mst.size() < n_stop) {
+        const auto edge = min_heap.top();
+        min_heap.pop();
+        const auto& [v, w, _] = edge;
+
+        // O(log*(n)) ~ O(1), the roots of v and w are found once
+        if (disjoint_set.try_unite(v, w)) {
+            mst.push_back(edge);
+        }
+    }
+
+    return mst;
+}
+
+#endif  // KRUSKAL_BINARY_HEAP_MST_H
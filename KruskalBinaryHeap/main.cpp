@@ -0,0 +1,43 @@
+#include <iostream>
+
+#include "CSRGraph.h"
+#include "batch_runner.h"
+#include "cli_options.h"
+#include "csr_graph_factory.h"
+#include "kruskal_binary_heap_mst.h"
+#include "sum_weights.h"
+
+int main(int argc, char* argv[]) {
+    typedef size_t Label;  // nodes are identified by size_t type
+    typedef long Weight;   // weights are of type long
+
+    // select how the input graph is loaded, e.g. --fast-input
+    const auto options = parse_cli_options(argc, argv);
+
+    // return the total weight of the Minimum Spanning Tree of the given graph
+    const auto mst_weight = [](CSRGraph<Label, Weight>&& csr_graph, std::size_t) {
+        // compute Minimum Spanning Tree with Kruskal algorithm, extracting the edges from a Binary
+        // Heap
+        const auto& mst = kruskal_binary_heap_mst(std::move(csr_graph));
+
+        // total weight of the mst found by Kruskal's algorithm
+        return sum_weights<Label, Weight>(mst.cbegin(), mst.cend());
+    };
+
+    try {
+        if (options.batch) {
+            const auto all_solved =
+                run_batch<CSRGraph<Label, Weight>, Label, Weight>(options, mst_weight);
+            return all_solved ? 0 : 1;
+        }
+
+        CSRGraph<Label, Weight> csr_graph(csr_graph_factory<Label, Weight>(options));
+        const auto total_weight = mst_weight(std::move(csr_graph), options.n_threads);
+
+        // use std::fixed to avoid displaying numbers in scientific notation
+        std::cout << std::fixed << total_weight << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
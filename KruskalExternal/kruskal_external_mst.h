@@ -0,0 +1,327 @@
+#ifndef KRUSKAL_EXTERNAL_MST_H
+#define KRUSKAL_EXTERNAL_MST_H
+
+#include <algorithm>   // std::max, std::min
+#include <cstdint>     // std::uint64_t
+#include <cstdio>      // std::FILE, std::tmpfile, std::fwrite, std::fread, std::fflush
+#include <functional>  // std::less
+#include <memory>      // std::unique_ptr
+#include <queue>       // std::priority_queue
+#include <stdexcept>   // std::runtime_error
+#include <utility>     // std::pair, std::move
+#include <vector>      // std::vector
+
+#include "DisjointSetFlat.h"
+#include "Edge.h"
+#include "sort_by_weight.h"
+
+namespace detail {
+
+    // closes the temporary file of the sorted runs, which is deleted when it is closed
+    struct file_closer {
+        void operator()(std::FILE* file) const noexcept {
+            std::fclose(file);
+        }
+    };
+
+    using run_file_t = std::unique_ptr<std::FILE, file_closer>;
+
+    // smallest number of edges of a sorted run, and of the buffer of a run while merging
+    constexpr std::size_t external_min_run_size = std::size_t(1) << 16;
+    constexpr std::size_t external_min_read_size = std::size_t(1) << 10;
+
+    // move the position of file to offset bytes from its beginning, also beyond 2 GiB.
+    // Return false on failure
+    inline bool seek(std::FILE* file, const std::uint64_t offset) noexcept {
+#ifdef _WIN32
+        return _fseeki64(file, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+        return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+    }
+
+    /**
+     * Sorted runs of edges stored one after the other in a single temporary file, so that the
+     * number of open files doesn't grow with the number of runs. The file is created by the first
+     * write, and deleted when the run_store is destroyed.
+     * A run_store is either written, one run at a time, or read by run_readers, after flush().
+     */
+    template <typename Label, typename Weight>
+    class run_store {
+        run_file_t file;
+
+        // bounds[i] and bounds[i + 1] -> indexes of the first edge of the i-th run and of the
+        // edge past its end. bounds.back() is the first edge of the run being written
+        std::vector<std::uint64_t> bounds{0};
+
+        // number of edges written
+        std::uint64_t size = 0;
+
+    public:
+        // append the edges [first, last) to the run being written
+        void write(const Edge<Label, Weight>* first, const Edge<Label, Weight>* last) {
+            if (!file) {
+                file.reset(std::tmpfile());
+            }
+
+            const auto count = static_cast<std::size_t>(last - first);
+            if (!file ||
+                std::fwrite(first, sizeof(Edge<Label, Weight>), count, file.get()) != count) {
+                throw std::runtime_error("kruskal_external_mst: cannot write a temporary run file");
+            }
+            size += count;
+        }
+
+        // end the run being written
+        void close_run() {
+            bounds.push_back(size);
+        }
+
+        // write the buffered edges to the file, before the runs are read
+        void flush() {
+            if (file && std::fflush(file.get()) != 0) {
+                throw std::runtime_error("kruskal_external_mst: cannot write a temporary run file");
+            }
+        }
+
+        [[nodiscard]] std::size_t runs_size() const noexcept {
+            return bounds.size() - 1;
+        }
+
+        // return the index of the first edge of the i-th run
+        [[nodiscard]] std::uint64_t run_begin(const std::size_t i) const noexcept {
+            return bounds[i];
+        }
+
+        // return the index of the edge past the end of the i-th run
+        [[nodiscard]] std::uint64_t run_end(const std::size_t i) const noexcept {
+            return bounds[i + 1];
+        }
+
+        [[nodiscard]] std::FILE* get() const noexcept {
+            return file.get();
+        }
+    };
+
+    // sequential reader of a sorted run of a run_store, through a buffer of buffer_size edges.
+    // The readers of a merge share the file, so every refill seeks to the position of its run
+    template <typename Label, typename Weight>
+    class run_reader {
+        std::FILE* file;
+        std::uint64_t offset;
+        std::uint64_t end;
+        std::vector<Edge<Label, Weight>> buffer;
+        std::size_t pos = 0;
+        std::size_t size = 0;
+
+    public:
+        run_reader(const run_store<Label, Weight>& store, const std::size_t i,
+                   const std::size_t buffer_size) :
+            file(store.get()),
+            offset(store.run_begin(i)),
+            end(store.run_end(i)),
+            buffer(buffer_size) {
+        }
+
+        // copy the next edge of the run in edge. Return false iff the run is over
+        bool next(Edge<Label, Weight>& edge) {
+            if (pos == size) {
+                if (offset == end) {
+                    return false;
+                }
+
+                const auto count =
+                    static_cast<std::size_t>(std::min<std::uint64_t>(buffer.size(), end - offset));
+                if (!seek(file, offset * sizeof(Edge<Label, Weight>)) ||
+                    std::fread(buffer.data(), sizeof(Edge<Label, Weight>), count, file) != count) {
+                    throw std::runtime_error(
+                        "kruskal_external_mst: cannot read a temporary run file");
+                }
+
+                offset += count;
+                pos = 0;
+                size = count;
+            }
+
+            edge = buffer[pos++];
+            return true;
+        }
+    };
+
+    /**
+     * k-way merge of the runs [first, last) of store, with a Min Heap of the first edge of every
+     * run that isn't over yet. emit(edge) is called on the merged edges in non-decreasing order
+     * of weight, until it returns false. Every run is read through a buffer of buffer_size edges.
+     * Time: O(s*logk), where s is the number of merged edges
+     */
+    template <typename Label, typename Weight, class Emit>
+    void merge_runs(const run_store<Label, Weight>& store, const std::size_t first,
+                    const std::size_t last, const std::size_t buffer_size, Emit&& emit) {
+        using edge_t = Edge<Label, Weight>;
+
+        std::vector<run_reader<Label, Weight>> readers;
+        readers.reserve(last - first);
+        for (auto i = first; i < last; ++i) {
+            readers.emplace_back(store, i, buffer_size);
+        }
+
+        // heads contains the first edge of a run paired with the run index in readers
+        using head_t = std::pair<edge_t, std::size_t>;
+        const auto heavier = [](const head_t& l, const head_t& r) {
+            return l.first.weight > r.first.weight;
+        };
+        std::priority_queue<head_t, std::vector<head_t>, decltype(heavier)> heads(heavier);
+
+        edge_t edge;
+        for (std::size_t i = 0; i < readers.size(); ++i) {
+            if (readers[i].next(edge)) {
+                heads.emplace(edge, i);
+            }
+        }
+
+        while (!heads.empty()) {
+            const auto [lightest, i] = heads.top();
+            heads.pop();
+            if (!emit(lightest)) {
+                return;
+            }
+
+            if (readers[i].next(edge)) {
+                heads.emplace(edge, i);
+            }
+        }
+    }
+
+}  // namespace detail
+
+/**
+ * Semi-external Kruskal algorithm, for edge lists that don't fit in memory: only the O(n)
+ * Disjoint-Set and the MST are kept in memory. The input is read once, and the edges are
+ * written to disk in sorted runs that are read back by the merge.
+ * 1. The edges returned by next_edge are collected in runs that fit in memory_budget bytes,
+ *    together with the buffer of the radix sort. Every run is sorted by weight on n_threads
+ *    threads and appended to a single temporary file, which is deleted when the algorithm
+ *    returns.
+ * 2. The runs are merged with a Min Heap of their first edges. A merge reads each of its runs,
+ *    and writes its output, through a buffer of at least external_min_read_size edges, so at most
+ *    fan_in = memory_budget / (external_min_read_size edges) - 1 runs fit in the budget (2 at
+ *    least). While there are more than fan_in runs, groups of fan_in runs are merged into longer
+ *    runs in a new temporary file. The last merge feeds the usual Kruskal loop on a
+ *    DisjointSetFlat, and it stops as soon as the MST is complete.
+ * If all the edges fit in a single run, it is sorted and processed in memory.
+ * At most 2 temporary files are open at any time, whatever the number of runs. Peak memory is
+ * about max(memory_budget, external_min_run_size edges, 3 * external_min_read_size edges) plus
+ * 4 bytes per vertex for the Disjoint-Set and the n - 1 edges of the MST.
+ * Time:  O(m*logk) for the merge passes of k = O(m / memory_budget) runs, which are
+ *        O(log_fan_in(k)), plus the O(m) radix sorts
+ * Space: O(n + memory_budget) in memory, O(m) on disk (2 copies of the edges during a pass)
+ *
+ * next_edge(Edge<Label, Weight>&) must copy the next edge of the graph in its argument and
+ * return true, or return false when the edges are over.
+ * Throws std::runtime_error if the temporary files can't be written or read.
+ */
+template <typename Label, typename Weight, class EdgeSource>
+auto kruskal_external_mst(const std::size_t n, EdgeSource&& next_edge,
+                          const std::size_t memory_budget, const std::size_t n_threads = 1)
+    -> std::vector<Edge<Label, Weight>> {
+    using edge_t = Edge<Label, Weight>;
+
+    // this vector will store the Minimum Spanning Tree
+    std::vector<edge_t> mst;
+    const size_t n_stop = n > 0 ? n - 1 : 0;
+    mst.reserve(n_stop);
+
+    // Disjoint-Set of the n vertexes, 4 bytes each
+    disjoint_set::DisjointSetFlat<Label> disjoint_set(n);
+
+    // add edge to the mst iff it doesn't close a cycle
+    const auto kruskal_step = [&mst, &disjoint_set](const edge_t& edge) {
+        if (disjoint_set.try_unite(edge.from, edge.to)) {
+            mst.push_back(edge);
+        }
+    };
+
+    // a run and the buffer of the radix sort must both fit in memory_budget
+    const auto run_size =
+        std::max(detail::external_min_run_size, memory_budget / (2 * sizeof(edge_t)));
+
+    // phase 1: sorted runs
+    detail::run_store<Label, Weight> runs;
+    std::vector<edge_t> run;
+    run.reserve(run_size);
+
+    edge_t edge;
+    bool edges_left = next_edge(edge);
+    while (edges_left) {
+        run.clear();
+        while (edges_left && run.size() < run_size) {
+            run.push_back(edge);
+            edges_left = next_edge(edge);
+        }
+
+        sort_by_weight(run, std::less<>{}, n_threads);
+
+        // every edge fits in memory: no temporary file is needed
+        if (runs.runs_size() == 0 && !edges_left) {
+            for (auto it = run.cbegin(); it != run.cend() && mst.size() < n_stop; ++it) {
+                kruskal_step(*it);
+            }
+            return mst;
+        }
+
+        runs.write(run.data(), run.data() + run.size());
+        runs.close_run();
+    }
+
+    // the memory of the last run is given to the buffers of the merges
+    std::vector<edge_t>().swap(run);
+    runs.flush();
+
+    // phase 2: merge the runs. A merge of k runs has k + 1 buffers that share memory_budget
+    const auto n_buffers = memory_budget / (detail::external_min_read_size * sizeof(edge_t));
+    const auto fan_in = std::max<std::size_t>(2, n_buffers > 1 ? n_buffers - 1 : 0);
+    const auto buffer_size = [memory_budget](const std::size_t k) {
+        return std::max(detail::external_min_read_size,
+                        memory_budget / ((k + 1) * sizeof(edge_t)));
+    };
+
+    // merge passes, until the runs left can be merged at once
+    while (runs.runs_size() > fan_in) {
+        detail::run_store<Label, Weight> merged;
+
+        for (std::size_t first = 0; first < runs.runs_size(); first += fan_in) {
+            const auto last = std::min(first + fan_in, runs.runs_size());
+            const auto size = buffer_size(last - first);
+
+            std::vector<edge_t> output;
+            output.reserve(size);
+            detail::merge_runs(runs, first, last, size, [&](const edge_t& lightest) {
+                output.push_back(lightest);
+                if (output.size() == size) {
+                    merged.write(output.data(), output.data() + output.size());
+                    output.clear();
+                }
+                return true;
+            });
+
+            merged.write(output.data(), output.data() + output.size());
+            merged.close_run();
+        }
+
+        // the file of the previous pass is deleted
+        runs = std::move(merged);
+        runs.flush();
+    }
+
+    // last merge: the merged edges are processed in non-decreasing order of weight. A Minimum
+    // Spanning Tree can have (n - 1) edges at maximum
+    detail::merge_runs(runs, 0, runs.runs_size(), buffer_size(runs.runs_size()),
+                       [&](const edge_t& lightest) {
+                           kruskal_step(lightest);
+                           return mst.size() < n_stop;
+                       });
+
+    return mst;
+}
+
+#endif  // KRUSKAL_EXTERNAL_MST_H
@@ -0,0 +1,39 @@
+#include <iostream>  // std::cout, std::cerr
+
+#include "cli_options.h"
+#include "edge_stream.h"
+#include "kruskal_external_mst.h"
+#include "sum_weights.h"
+
+int main(int argc, char* argv[]) {
+    typedef size_t Label;  // nodes are identified by size_t type
+    typedef long Weight;   // weights are of type long
+
+    // select how the input graph is loaded, the memory budget and the number of threads
+    const auto options = parse_cli_options(argc, argv);
+
+    // the edges are streamed from the input instead of being loaded in a graph, so a batch of
+    // graphs can't be read
+    if (options.batch) {
+        std::cerr << argv[0] << ": --batch is not supported" << std::endl;
+        return 1;
+    }
+
+    try {
+        // the edges are read once, sequentially, and never stored all together
+        const auto external_mst = [&options](const std::size_t n, auto&& next_edge) {
+            return kruskal_external_mst<Label, Weight>(n, next_edge, options.memory_budget,
+                                                       options.n_threads);
+        };
+        const auto mst = stream_edges<Label, Weight>(options, external_mst);
+
+        // total weight of the mst found by Kruskal's algorithm
+        const auto total_weight = sum_weights<Label, Weight>(mst.cbegin(), mst.cend());
+
+        // use std::fixed to avoid displaying numbers in scientific notation
+        std::cout << std::fixed << total_weight << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
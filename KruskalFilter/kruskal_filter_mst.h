@@ -0,0 +1,100 @@
+#ifndef KRUSKAL_FILTER_MST_H
+#define KRUSKAL_FILTER_MST_H
+
+#include <algorithm>  // std::partition, std::remove_if
+#include <iterator>   // std::distance
+#include <vector>     // std::vector
+
+#include "DisjointSetFlat.h"
+#include "Edge.h"
+#include "edge_vector.h"
+#include "filter_kruskal.h"
+
+namespace detail {
+
+    /**
+     * Filter-Kruskal on the edges in [first, last).
+     * The edges are partitioned around a pivot weight like in quicksort. The light edges are
+     * processed first, then the heavy edges whose end nodes have already been connected by the
+     * light ones are discarded without being sorted, and the remaining ones are processed.
+     * Ranges with at most threshold edges are processed by kruskal_range.
+     */
+    template <typename Label, typename Weight, class It, class DisjointSet>
+    void filter_kruskal(It first, It last, DisjointSet& disjoint_set,
+                        std::vector<Edge<Label, Weight>>& mst, const std::size_t n_stop,
+                        const std::size_t threshold) {
+        if (mst.size() == n_stop) {
+            return;
+        }
+
+        if (static_cast<std::size_t>(std::distance(first, last)) <= threshold) {
+            kruskal_range<Label, Weight>(first, last, disjoint_set, mst, n_stop);
+            return;
+        }
+
+        // light edges are moved to [first, middle), heavy edges to [middle, last)
+        const Weight pivot = median_of_three_weight<Weight>(first, last);
+        auto middle =
+            std::partition(first, last, [pivot](const auto& e) { return e.weight < pivot; });
+
+        // the pivot is the lightest weight: put the edges with the pivot weight on the light side
+        if (middle == first) {
+            middle =
+                std::partition(first, last, [pivot](const auto& e) { return e.weight <= pivot; });
+
+            // every edge has the same weight, there is nothing left to partition
+            if (middle == last) {
+                kruskal_range<Label, Weight>(first, last, disjoint_set, mst, n_stop);
+                return;
+            }
+        }
+
+        filter_kruskal<Label, Weight>(first, middle, disjoint_set, mst, n_stop, threshold);
+
+        // discard the heavy edges that would close a cycle
+        const auto heavy_last = std::remove_if(middle, last, [&disjoint_set](const auto& e) {
+            return disjoint_set.are_connected(e.from, e.to);
+        });
+
+        filter_kruskal<Label, Weight>(middle, heavy_last, disjoint_set, mst, n_stop, threshold);
+    }
+
+}  // namespace detail
+
+/**
+ * Filter-Kruskal: Kruskal algorithm that avoids sorting most of the heavy edges, which are
+ * discarded as soon as the lighter edges connect their end nodes.
+ * Time:  O(m + nlog(n)log(m/n)) expected on random graphs, O(mlogm) in the worst case
+ * Space: O(m)
+ */
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+auto kruskal_filter_mst(Graph<Label, Weight>&& graph) noexcept
+    -> std::vector<Edge<Label, Weight>> {
+    // this vector will store the Minimum Spanning Tree
+    std::vector<Edge<Label, Weight>> mst;
+    const size_t n_stop = graph.vertexes_size() - 1;
+    mst.reserve(n_stop);
+
+    // the edges are partitioned in place
+    auto edges = get_edge_vector(graph);
+
+    // generate vector of vertexes in O(n) time
+    auto vertexes = graph.get_vertexes();
+
+    /**
+     * Create a new Disjoint-Set data structure to store the vertexes.
+     * Initially, every vertex is in a separate set.
+     * vertexes is no longer accessible after the process.
+     */
+    disjoint_set::DisjointSetFlat<Label> disjoint_set(std::move(vertexes));
+
+    // ranges with at most threshold edges are sorted right away
+    const auto threshold = detail::filter_kruskal_threshold(graph.vertexes_size());
+
+    detail::filter_kruskal<Label, Weight>(edges.begin(), edges.end(), disjoint_set, mst, n_stop,
+                                          threshold);
+
+    return mst;
+}
+
+#endif  // KRUSKAL_FILTER_MST_H
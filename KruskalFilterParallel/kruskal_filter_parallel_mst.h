@@ -0,0 +1,229 @@
+#ifndef KRUSKAL_FILTER_PARALLEL_MST_H
+#define KRUSKAL_FILTER_PARALLEL_MST_H
+
+#include <algorithm>  // std::partition, std::copy
+#include <vector>     // std::vector
+
+#include "DisjointSetCompressed.h"
+#include "Edge.h"
+#include "edge_vector.h"
+#include "filter_kruskal.h"
+#include "parallel_for.h"
+
+namespace detail {
+
+    // state shared by the recursive calls of parallel_filter_kruskal
+    template <typename Label, typename Weight>
+    struct parallel_filter_kruskal_state {
+        // edges, partitioned in place
+        std::vector<Edge<Label, Weight>>& edges;
+
+        // edges[i] is copied to buffer[i] while it's being partitioned
+        std::vector<Edge<Label, Weight>> buffer;
+
+        // component[v] -> representative of the set of v in the Disjoint-Set, updated before
+        // every filter step. The threads read it instead of the Disjoint-Set, whose find()
+        // compresses paths
+        std::vector<Label> component;
+
+        disjoint_set::DisjointSetCompressed<Label>& disjoint_set;
+
+        // this vector will store the Minimum Spanning Tree
+        std::vector<Edge<Label, Weight>>& mst;
+
+        // number of edges of a complete MST
+        const std::size_t n_stop;
+
+        // ranges with at most threshold edges are sorted instead of being partitioned
+        const std::size_t threshold;
+
+        // number of threads, already resolved
+        const std::size_t threads;
+
+        // n_true[chunk] -> number of edges of the chunk that satisfy the partition predicate
+        std::vector<std::size_t> n_true;
+    };
+
+    /**
+     * Move the edges of edges[first, last) that satisfy pred before the ones that don't, and
+     * return the index of the first edge that doesn't satisfy it.
+     * Every chunk counts its edges that satisfy pred, then it copies them to buffer after the
+     * ones of the previous chunks, followed by the edges that don't satisfy pred. Finally the
+     * edges are copied back. A range that fits in a single chunk is partitioned in place.
+     * Time:  O((last - first)/p) with p threads
+     * Space: O(1), buffer is preallocated
+     */
+    template <typename Label, typename Weight, class Predicate>
+    std::size_t parallel_partition(parallel_filter_kruskal_state<Label, Weight>& state,
+                                   const std::size_t first, const std::size_t last,
+                                   Predicate&& pred) {
+        auto& edges = state.edges;
+        auto& n_true = state.n_true;
+
+        const auto count = [&](const std::size_t chunk_first, const std::size_t chunk_last,
+                               const std::size_t chunk) {
+            std::size_t count = 0;
+            for (auto i = first + chunk_first; i < first + chunk_last; ++i) {
+                count += pred(edges[i]) ? 1 : 0;
+            }
+            n_true[chunk] = count;
+        };
+
+        const auto n_chunks = parallel_for(last - first, state.threads, count);
+        if (n_chunks == 1) {
+            const auto middle = std::partition(edges.begin() + first, edges.begin() + last, pred);
+            return static_cast<std::size_t>(middle - edges.begin());
+        }
+
+        // turn the counts into the index in buffer of the first edge of every chunk that
+        // satisfies pred
+        std::size_t total_true = 0;
+        for (std::size_t chunk = 0; chunk < n_chunks; ++chunk) {
+            const auto chunk_true = n_true[chunk];
+            n_true[chunk] = first + total_true;
+            total_true += chunk_true;
+        }
+
+        const auto scatter = [&](const std::size_t chunk_first, const std::size_t chunk_last,
+                                 const std::size_t chunk) {
+            // the edges that don't satisfy pred follow all the ones that do
+            auto true_out = n_true[chunk];
+            const auto true_before = true_out - first;
+            auto false_out = first + total_true + (chunk_first - true_before);
+            for (auto i = first + chunk_first; i < first + chunk_last; ++i) {
+                if (pred(edges[i])) {
+                    state.buffer[true_out++] = edges[i];
+                } else {
+                    state.buffer[false_out++] = edges[i];
+                }
+            }
+        };
+
+        const auto copy_back = [&](const std::size_t chunk_first, const std::size_t chunk_last,
+                                   std::size_t) {
+            const auto buffer_first = state.buffer.begin() + first;
+            std::copy(buffer_first + chunk_first, buffer_first + chunk_last,
+                      edges.begin() + first + chunk_first);
+        };
+
+        parallel_for(last - first, state.threads, scatter);
+        parallel_for(last - first, state.threads, copy_back);
+
+        return first + total_true;
+    }
+
+    /**
+     * Filter-Kruskal on edges[first, last), whose partition and filter steps run in parallel.
+     * The edges are partitioned around a pivot weight like in quicksort. The light edges are
+     * processed first, then a snapshot of the components of the Disjoint-Set is taken, and the
+     * heavy edges whose end nodes are in the same component are discarded by all the threads
+     * reading the snapshot. Only the edges that survive are then processed.
+     * Ranges with at most threshold edges are processed by kruskal_range, whose sort is
+     * parallel as well.
+     */
+    template <typename Label, typename Weight>
+    void parallel_filter_kruskal(parallel_filter_kruskal_state<Label, Weight>& state,
+                                 const std::size_t first, const std::size_t last) {
+        auto& edges = state.edges;
+        const auto begin = edges.begin();
+
+        if (state.mst.size() == state.n_stop) {
+            return;
+        }
+
+        if (last - first <= state.threshold) {
+            kruskal_range<Label, Weight>(begin + first, begin + last, state.disjoint_set,
+                                         state.mst, state.n_stop, state.threads);
+            return;
+        }
+
+        // light edges are moved to [first, middle), heavy edges to [middle, last)
+        const Weight pivot = median_of_three_weight<Weight>(begin + first, begin + last);
+        auto middle = parallel_partition(state, first, last,
+                                         [pivot](const auto& e) { return e.weight < pivot; });
+
+        // the pivot is the lightest weight: put the edges with the pivot weight on the light side
+        if (middle == first) {
+            middle = parallel_partition(state, first, last,
+                                        [pivot](const auto& e) { return e.weight <= pivot; });
+
+            // every edge has the same weight, there is nothing left to partition
+            if (middle == last) {
+                kruskal_range<Label, Weight>(begin + first, begin + last, state.disjoint_set,
+                                             state.mst, state.n_stop, state.threads);
+                return;
+            }
+        }
+
+        parallel_filter_kruskal(state, first, middle);
+
+        if (state.mst.size() == state.n_stop) {
+            return;
+        }
+
+        // snapshot of the components. It takes O(n) time, but every range that is filtered has
+        // more than n edges
+        auto& component = state.component;
+        for (std::size_t v = 0; v < component.size(); ++v) {
+            component[v] = state.disjoint_set.find(v);
+        }
+
+        // discard the heavy edges that would close a cycle
+        const auto heavy_last = parallel_partition(state, middle, last, [&component](const auto& e) {
+            return component[e.from] != component[e.to];
+        });
+
+        parallel_filter_kruskal(state, middle, heavy_last);
+    }
+
+}  // namespace detail
+
+/**
+ * Parallel Filter-Kruskal: Filter-Kruskal algorithm whose partition and filter steps are split
+ * among n_threads threads. The heavy edges are filtered against a read-only snapshot of the
+ * components of a DisjointSetCompressed, so that only the surviving edges are processed
+ * serially by Kruskal.
+ * n_threads equal to 0 means one thread for every hardware thread.
+ * Time:  O(m/p + nlog(n)log(m/n)) expected on random graphs with p threads
+ * Space: O(m)
+ */
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+auto kruskal_filter_parallel_mst(Graph<Label, Weight>&& graph,
+                                 const std::size_t n_threads) noexcept
+    -> std::vector<Edge<Label, Weight>> {
+    // this vector will store the Minimum Spanning Tree
+    std::vector<Edge<Label, Weight>> mst;
+    const size_t n = graph.vertexes_size();
+    const size_t n_stop = n - 1;
+    mst.reserve(n_stop);
+
+    // the edges are partitioned in place
+    auto edges = get_edge_vector(graph);
+    const auto m = edges.size();
+
+    /**
+     * Create a new Disjoint-Set data structure to store the vertexes.
+     * Initially, every vertex is in a separate set.
+     */
+    disjoint_set::DisjointSetCompressed<Label> disjoint_set(graph.get_vertexes());
+
+    // the partition buffer is needed only by more than one thread
+    const auto threads = resolve_thread_count(n_threads);
+    detail::parallel_filter_kruskal_state<Label, Weight> state{
+        edges,
+        std::vector<Edge<Label, Weight>>(threads > 1 ? m : 0),
+        std::vector<Label>(n),
+        disjoint_set,
+        mst,
+        n_stop,
+        detail::filter_kruskal_threshold(n),
+        threads,
+        std::vector<std::size_t>(threads),
+    };
+
+    detail::parallel_filter_kruskal(state, 0, m);
+
+    return mst;
+}
+
+#endif  // KRUSKAL_FILTER_PARALLEL_MST_H
@@ -0,0 +1,52 @@
+#ifndef KRUSKAL_LINK_CUT_MST_H
+#define KRUSKAL_LINK_CUT_MST_H
+
+#include <functional>  // std::less
+#include <vector>      // std::vector
+
+#include "Edge.h"
+#include "LinkCutTree.h"
+
+/**
+ * Kruskal algorithm that checks online whether every edge would close a cycle in the spanning
+ * forest built so far, like kruskal_naive_mst, but asking a link-cut tree instead of running
+ * a graph search: both connected() and link() take O(logn) amortized time instead of O(n).
+ * Unlike a Disjoint-Set, the link-cut tree stores the forest itself, so its edges could also
+ * be cut or queried for the heaviest edge on a path.
+ * Time:  O(m + klogn), where k is the number of edges scanned before the MST is complete
+ * Space: O(m)
+ */
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+auto kruskal_link_cut_mst(Graph<Label, Weight>&& graph, const std::size_t n_threads = 1)
+    -> std::vector<Edge<Label, Weight>> {
+    const size_t n = graph.vertexes_size();
+
+    // this vector will store the Minimum Spanning Tree
+    std::vector<Edge<Label, Weight>> mst;
+    const size_t n_stop = n > 0 ? n - 1 : 0;
+    mst.reserve(n_stop);
+
+    // sort edges in non-decreasing order of weight in O(m) time with a radix sort, which is
+    // split among n_threads threads
+    auto edges = graph.get_sorted_edges(std::less<>{}, n_threads);
+
+    // forest of the n vertexes, initially without edges
+    dynamic_tree::LinkCutTree<Label, Weight> forest(n);
+
+    // Iterate over the edges, stop early if the MST reached its maximum size (n - 1 edges).
+    // The mst is populated in O(mlogn) time
+    for (auto it = edges.cbegin(); it != edges.cend() && mst.size() < n_stop; ++it) {
+        const auto& edge = *it;
+
+        // pre: forest has no cycles. If the end nodes of edge are already connected, adding
+        // edge would introduce a loop
+        if (!forest.connected(edge.from, edge.to)) {
+            forest.link(edge);
+            mst.push_back(edge);
+        }
+    }
+
+    return mst;
+}
+
+#endif  // KRUSKAL_LINK_CUT_MST_H
@@ -7,25 +7,30 @@
 #include "AdjacencyMapGraph.h"
 #include "DFSCycleDetection.h"
 
-template <typename Label, typename Weight>
-auto kruskal_naive_mst(AdjacencyMapGraph<Label, Weight>&& adj_map_graph) noexcept
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+auto kruskal_naive_mst(Graph<Label, Weight>&& graph,
+                       const std::size_t n_threads = 1) noexcept
     -> std::unordered_set<Edge<Label, Weight>, custom_hash::edge_hash> {
-    const size_t n = adj_map_graph.vertexes_size();
+    const size_t n = graph.vertexes_size();
 
     // adjacency map that will store the Minimum Spanning Tree
     AdjacencyMapGraph<Label, Weight> mst_set_graph({}, n);
 
-    // sort edges in non-decreasing order of weight in O(m * log(m)) time
-    auto edges = adj_map_graph.get_sorted_edges(std::less<>{});
+    // sort edges in non-decreasing order of weight in O(m) time with a radix sort, which is
+    // split among n_threads threads
+    auto edges = graph.get_sorted_edges(std::less<>{}, n_threads);
 
     // object that detects cycles in a graph using Depth First Search.
     // dfs uses mst_set_graph in read-only mode.
     DFSCycleDetection<Label, Weight> dfs(&mst_set_graph);
 
-    // Iterate over the edges, stop early if the MST reached its maximum size (n vertexes).
+    // a spanning tree of n vertexes has exactly n - 1 edges
+    const std::size_t n_stop = n > 0 ? n - 1 : 0;
+    std::size_t mst_size = 0;
+
+    // Iterate over the edges, stop early if the MST reached its maximum size (n - 1 edges).
     // The mst is populated in O(m*n) time
-    for (auto it = edges.cbegin(); !(it == edges.cend() && n == mst_set_graph.vertexes_size());
-         ++it) {
+    for (auto it = edges.cbegin(); it != edges.cend() && mst_size < n_stop; ++it) {
         // edge is the object pointed by the current iterator
         const auto& edge = *it;
 
@@ -37,6 +42,7 @@ auto kruskal_naive_mst(AdjacencyMapGraph<Label, Weight>&& adj_map_graph) noexcep
         if (!dfs.are_connected(edge.from, edge.to)) {
             // add the current edge to the spanning tree
             mst_set_graph.add_edge(edge);
+            ++mst_size;
         }
     }
 
@@ -2,21 +2,43 @@
 
 #include "AdjacencyMapGraph.h"
 #include "adjacency_map_graph_factory.h"
+#include "batch_runner.h"
+#include "cli_options.h"
 #include "sum_weights.h"
 #include "kruskal_naive_mst.h"
 
-int main() noexcept {
+int main(int argc, char* argv[]) {
 	typedef size_t Label; // nodes are identified by size_t type
 	typedef long Weight;  // weights are of type long
 
-	AdjacencyMapGraph<Label, Weight> adj_map_graph(adjacency_map_graph_factory<Label, Weight>());
+	// select how the input graph is loaded, e.g. --fast-input
+	const auto options = parse_cli_options(argc, argv);
 
-    // compute Minimum Spanning Tree with Kruskal naive algorithm
-    const auto& mst = kruskal_naive_mst(std::move(adj_map_graph));
+    // return the total weight of the Minimum Spanning Tree of the given graph
+    const auto mst_weight = [](AdjacencyMapGraph<Label, Weight>&& adj_map_graph,
+                               const std::size_t n_threads) {
+        // compute Minimum Spanning Tree with Kruskal naive algorithm
+        const auto& mst = kruskal_naive_mst(std::move(adj_map_graph), n_threads);
 
-    // total weight of the mst found by Kruskal's algorithm
-    const auto total_weight = sum_weights<Label, Weight>(mst.cbegin(), mst.cend());
+        // total weight of the mst found by Kruskal's algorithm
+        return sum_weights<Label, Weight>(mst.cbegin(), mst.cend());
+    };
 
-    // use std::fixed to avoid displaying numbers in scientific notation
-    std::cout << std::fixed << total_weight << std::endl;
+    try {
+        if (options.batch) {
+            const auto all_solved =
+                run_batch<AdjacencyMapGraph<Label, Weight>, Label, Weight>(options, mst_weight);
+            return all_solved ? 0 : 1;
+        }
+
+        AdjacencyMapGraph<Label, Weight> adj_map_graph(
+            adjacency_map_graph_factory<Label, Weight>(options));
+        const auto total_weight = mst_weight(std::move(adj_map_graph), options.n_threads);
+
+        // use std::fixed to avoid displaying numbers in scientific notation
+        std::cout << std::fixed << total_weight << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
 }
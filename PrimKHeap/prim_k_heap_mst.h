@@ -5,13 +5,12 @@
 #include <limits>     // std::numeric_limits
 #include <vector>     // std::vector
 
-#include "AdjacencyMapGraph.h"
+#include "Edge.h"
 #include "PriorityQueue.h"
 
-template <typename Label, typename Weight>
-std::vector<Edge<Label, Weight>> prim_k_heap_mst(
-    AdjacencyMapGraph<Label, Weight>&& adj_map_graph) noexcept {
-    auto vertexes = adj_map_graph.get_vertexes();
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+std::vector<Edge<Label, Weight>> prim_k_heap_mst(Graph<Label, Weight>&& graph) noexcept {
+    auto vertexes = graph.get_vertexes();
 
     const size_t n_stop = vertexes.size();
     std::vector<Edge<Label, Weight>> mst(n_stop);
@@ -41,7 +40,7 @@ std::vector<Edge<Label, Weight>> prim_k_heap_mst(
         min_pq.pop();
 
         // traverse all vertexes which are adjacent to u
-        for (const auto [v, weight] : adj_map_graph.adjacent_vertexes(u)) {
+        for (const auto& [v, weight] : graph.adjacent_vertexes(u)) {
             // if v is not in MST and w(u, v) is smaller than the current key of v
             if (min_pq.contains(v) && weight < min_pq.key_at(v)) {
                 // update the key associated with node v in O(logN), where N is the number
@@ -0,0 +1,78 @@
+#ifndef PRIM_LAZY_BINARY_HEAP_MST_H
+#define PRIM_LAZY_BINARY_HEAP_MST_H
+
+#include <limits>   // std::numeric_limits
+#include <utility>  // std::pair
+#include <vector>   // std::vector
+
+#include "BinaryHeap.h"
+#include "Edge.h"
+
+/**
+ * Prim algorithm with lazy deletion. Instead of decreasing the key of a vertex in an indexed
+ * priority queue, a new (key, vertex) pair is pushed in a plain Binary Heap every time a lighter
+ * edge towards that vertex is found. Outdated pairs are left in the heap and skipped when they
+ * are popped, because their vertex has already been added to the MST.
+ * The heap stores trivially copyable pairs and doesn't keep track of their positions, so every
+ * operation on it is cheaper than on PriorityQueue, at the cost of a heap of O(m) pairs.
+ * Time:  O(mlogm)
+ * Space: O(n + m)
+ */
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+std::vector<Edge<Label, Weight>> prim_lazy_binary_heap_mst(Graph<Label, Weight>&& graph) noexcept {
+    const size_t n = graph.vertexes_size();
+    std::vector<Edge<Label, Weight>> mst(n);
+
+    if (n == 0) {
+        return mst;
+    }
+
+    // Keys are used to pick the lightest edge in cut.
+    // Initially, keys of all vertexes are set to infinity.
+    constexpr Weight Infinity = std::numeric_limits<Weight>::max();
+    std::vector<Weight> keys(n, Infinity);
+
+    // visited[v] is true iff v has already been added to the MST
+    std::vector<bool> visited(n, false);
+
+    // Min Heap of (key, vertex) pairs, ordered by key. An empty vector is already a valid heap.
+    constexpr bool IsAlreadyHeap = true;
+    std::vector<std::pair<Weight, Label>> entries;
+    entries.reserve(n);
+    auto min_heap(heap::make_min_heap<IsAlreadyHeap>(std::move(entries)));
+
+    // the source vertex can be randomly chosen. For simplicity, we choose the first vertex
+    // available. the first vertex is distant 0 from itself
+    keys[0] = Weight(0);
+    min_heap.push(Weight(0), Label(0));
+
+    while (!min_heap.empty()) {
+        // u is the vertex with minimum key that belongs to the lightest edge of the cut
+        const auto u = min_heap.top().second;
+        min_heap.pop();
+
+        // skip the outdated pairs of vertexes that are already in the MST
+        if (visited[u]) {
+            continue;
+        }
+        visited[u] = true;
+
+        // traverse all vertexes which are adjacent to u
+        for (const auto& [v, weight] : graph.adjacent_vertexes(u)) {
+            // if v is not in MST and w(u, v) is smaller than the current key of v
+            if (!visited[v] && weight < keys[v]) {
+                keys[v] = weight;
+
+                // the previous pair of v, if any, becomes outdated
+                min_heap.push(weight, v);
+
+                // add the edge (u, v) to the Minimum Spanning Tree
+                mst[v] = Edge<Label, Weight>(u, v, weight);
+            }
+        }
+    }
+
+    return mst;
+}
+
+#endif  // PRIM_LAZY_BINARY_HEAP_MST_H
@@ -0,0 +1,53 @@
+#ifndef PRIM_PAIRING_HEAP_MST_H
+#define PRIM_PAIRING_HEAP_MST_H
+
+#include <limits>  // std::numeric_limits
+#include <vector>  // std::vector
+
+#include "Edge.h"
+#include "PairingHeap.h"
+
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+std::vector<Edge<Label, Weight>> prim_pairing_heap_mst(Graph<Label, Weight>&& graph) noexcept {
+    auto vertexes = graph.get_vertexes();
+
+    const size_t n_stop = vertexes.size();
+    std::vector<Edge<Label, Weight>> mst(n_stop);
+
+    // Keys are used to pick the lightest edge in cut.
+    // Initially, keys of all vertexes are set to infinity.
+    constexpr Weight Infinity = std::numeric_limits<Weight>::max();
+    std::vector<Weight> keys(vertexes.size(), Infinity);
+
+    // the source vertex can be randomly chosen. For simplicity, we choose the first vertex
+    // available. the first vertex is distant 0 from itself
+    keys.at(0) = Weight(0);
+
+    // Priority Queue based on a Min Pairing Heap ordered by keys, from smaller to larger.
+    // Every vertex is inserted in O(1) time, so the priority queue creation takes O(N) time
+    auto min_pq(priority_queue::make_min_pairing_priority_queue(keys, vertexes));
+
+    // Loop until the the priority queue is empty or mst reached its maximum
+    // size (n - 1 edges)
+    while (!(min_pq.empty() && n_stop == mst.size())) {
+        // u is the vertex with minimum key that belongs to the lightest edge of the cut
+        auto u = min_pq.top();
+        min_pq.pop();
+
+        // traverse all vertexes which are adjacent to u
+        for (const auto& [v, weight] : graph.adjacent_vertexes(u)) {
+            // if v is not in MST and w(u, v) is smaller than the current key of v
+            if (min_pq.contains(v) && weight < min_pq.key_at(v)) {
+                // decrease the key associated with node v in O(1) amortized time
+                min_pq.update_key(weight, v);
+
+                // add the edge (u, v) to the Minimum Spanning Tree
+                mst.at(v) = Edge<Label, Weight>(u, v, weight);
+            }
+        }
+    }
+
+    return mst;
+}
+
+#endif  // PRIM_PAIRING_HEAP_MST_H
@@ -1,66 +1,13 @@
 #ifndef ADJACENCY_MAP_GRAPH_H
 #define ADJACENCY_MAP_GRAPH_H
 
-#include <algorithm>      // std::transform, std::sort
+#include <algorithm>      // std::transform
 #include <unordered_map>  // std::unordered_map
 #include <unordered_set>  // std::unordered_set
 #include <vector>         // std::vector
 
-/**
- * Edge represents a weighted edge between two vertexes.
- */
-template <typename Label, typename Weight>
-struct Edge {
-    Label from;
-    Label to;
-    Weight weight;
-
-    /**
-     * Default constructor used to represent "null" values when the MST is initialized
-     * in Prim's algorithm.
-     */
-    Edge() noexcept = default;
-
-    explicit Edge(const Label& from, const Label& to, const Weight& weight) noexcept :
-        from(from), to(to), weight(weight) {
-    }
-
-    /**
-     * Default assignment operator, needed to sort a container of Edges in place
-     */
-    Edge<Label, Weight>& operator=(const Edge<Label, Weight>& rhs) noexcept = default;
-
-    /**
-     * Default copy and move constructors, needed because in Prim's algorithm we need
-     * to override edges
-     */
-    Edge(const Edge<Label, Weight>& rhs) noexcept = default;
-    Edge(Edge<Label, Weight>&& rhs) noexcept = default;
-
-    /**
-     * Equality operator, used by std::unordered_set.
-     * (from, to, w1) and (to, from, w2) are considered the same edge, even if
-     * the weights are different.
-     */
-    bool operator==(const Edge& e) const noexcept {
-        return (from == e.from && to == e.to) || (to == e.from && from == e.to);
-    }
-};
-
-/**
- * Hash functors for custom types
- */
-namespace custom_hash {
-    // commutative hash functor for Edge<Label, Weight>
-    struct edge_hash {
-        template <class Label, class Weight>
-        std::size_t operator()(const Edge<Label, Weight>& edge) const noexcept {
-            constexpr auto hash_max = std::numeric_limits<Label>::max();
-            const auto& [i, j, _] = edge;
-            return (i * j + (i * i) * (j * j) + (i * i * i) * (j * j * j)) % hash_max;
-        }
-    };
-}  // namespace custom_hash
+#include "Edge.h"
+#include "sort_by_weight.h"
 
 /**
  * Adjacency Map class for undirected weighted graphs.
@@ -95,11 +42,12 @@ class AdjacencyMapGraph {
     edge_set_t edge_set;
 
     /**
-     * Initializes the graph starting from a vector of edges. The given number of vertexes is used
-     * to efficiently preallocate memory and void exprensive and multiple rehashes. Time: O(n + m)
-     * Space: O(n + m)
+     * Initializes the graph starting from the array of edges [first, last). The given number of
+     * vertexes is used to efficiently preallocate memory and void exprensive and multiple
+     * rehashes. Time: O(n + m) Space: O(n + m)
      */
-    void init(const std::vector<Edge<Label, Weight>>& edge_list, size_t n_vertex) noexcept;
+    void init(const Edge<Label, Weight>* first, const Edge<Label, Weight>* last,
+              size_t n_vertex) noexcept;
 
 public:
     /**
@@ -109,7 +57,19 @@ public:
      */
     explicit AdjacencyMapGraph(std::vector<Edge<Label, Weight>>&& edge_list,
                                const size_t n_vertex = 0) noexcept {
-        init(edge_list, n_vertex);
+        init(edge_list.data(), edge_list.data() + edge_list.size(), n_vertex);
+    }
+
+    /**
+     * Creates a graph representation starting from the array of edges [first, last), which is
+     * only read during the construction. This lets the graph be built straight out of a
+     * memory-mapped file.
+     * Time: O(n + m)
+     * Space: O(n + m)
+     */
+    explicit AdjacencyMapGraph(const Edge<Label, Weight>* first, const Edge<Label, Weight>* last,
+                               const size_t n_vertex = 0) noexcept {
+        init(first, last, n_vertex);
     }
 
     /**
@@ -135,11 +95,14 @@ public:
 
     /**
      * Return the set of edges sorted by weight according to the given comparator.
-     * Time:  O(mlogm)
+     * Integral weights are radix sorted on n_threads threads, see sort_by_weight.
+     * Time:  O(m/p) with p threads for integral weights ordered by std::less or std::greater,
+     *        O(mlogm) otherwise
      * Space: O(m)
      */
     template <class Comparator>
-    [[nodiscard]] std::vector<Edge<Label, Weight>> get_sorted_edges(Comparator&& comparator) const;
+    [[nodiscard]] std::vector<Edge<Label, Weight>> get_sorted_edges(
+        Comparator&& comparator, std::size_t n_threads = 1) const;
 
     /**
      * Return true iff the given vertex is in the graph.
@@ -178,11 +141,12 @@ public:
 };
 
 template <typename Label, typename Weight>
-inline void AdjacencyMapGraph<Label, Weight>::init(
-    const std::vector<Edge<Label, Weight>>& edge_list, const size_t n_vertex) noexcept {
+inline void AdjacencyMapGraph<Label, Weight>::init(const Edge<Label, Weight>* first,
+                                                   const Edge<Label, Weight>* last,
+                                                   const size_t n_vertex) noexcept {
     // preallocate memory
     adj_map.reserve(n_vertex);
-    edge_set.reserve(edge_list.size());
+    edge_set.reserve(static_cast<size_t>(last - first));
 
     // this vertex initialization is redundant in the case of connected graphs, which
     // is the type of input we expect.
@@ -192,8 +156,8 @@ inline void AdjacencyMapGraph<Label, Weight>::init(
         adj_map[v];
     }
 
-    for (const auto& edge : edge_list) {
-        add_edge(edge);
+    for (auto it = first; it != last; ++it) {
+        add_edge(*it);
     }
 }
 
@@ -225,19 +189,11 @@ AdjacencyMapGraph<Label, Weight>::get_edges() const noexcept {
 template <typename Label, typename Weight>
 template <class Comparator>
 inline std::vector<Edge<Label, Weight>> AdjacencyMapGraph<Label, Weight>::get_sorted_edges(
-    Comparator&& comparator) const {
-    const auto edges = get_edges();
-    std::vector<Edge<Label, Weight>> sorted_edges;
-    sorted_edges.reserve(edges.size());
-
-    // copy the content of edges into sorted_edges
-    sorted_edges.insert(sorted_edges.end(), edges.cbegin(), edges.cend());
-
-    // sort the values in sorted_edges applying the comparator to the internal weights
-    std::sort(sorted_edges.begin(), sorted_edges.end(),
-              [comp{std::forward<Comparator>(comparator)}](const auto& l, const auto& r) {
-                  return comp(l.weight, r.weight);
-              });
+    Comparator&& comparator, const std::size_t n_threads) const {
+    // copy the content of edge_set into sorted_edges
+    std::vector<Edge<Label, Weight>> sorted_edges(edge_set.cbegin(), edge_set.cend());
+
+    sort_by_weight(sorted_edges, std::forward<Comparator>(comparator), n_threads);
 
     return sorted_edges;
 }
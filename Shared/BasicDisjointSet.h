@@ -0,0 +1,253 @@
+#ifndef BASIC_DISJOINT_SET_H
+#define BASIC_DISJOINT_SET_H
+
+#include <type_traits>  // std::is_same
+#include <utility>      // std::swap
+#include <vector>       // std::vector
+
+#include "DisjointSetBase.h"
+
+namespace disjoint_set {
+
+    /**
+     * Linking rules. Every rule keeps the data it needs for each element, and its link(parents,
+     * i, j) method makes one of the 2 distinct roots i and j the parent of the other one.
+     */
+
+    // the root of the smaller set points to the root of the bigger set
+    class link_by_size {
+        // vector that keeps track of the size of every set, valid only for the roots
+        std::vector<std::size_t> sizes;
+
+    public:
+        explicit link_by_size(const std::size_t n) : sizes(n, 1) {
+        }
+
+        void link(std::vector<std::size_t>& parents, std::size_t i, std::size_t j) noexcept {
+            if (sizes[i] < sizes[j]) {
+                std::swap(i, j);
+            }
+
+            parents[j] = i;
+            sizes[i] += sizes[j];
+        }
+    };
+
+    // the root with the smaller rank points to the root with the bigger rank. In case of tie,
+    // the rank of the resulting root is increased by 1
+    class link_by_rank {
+        // vector that keeps track of the rank of every element
+        std::vector<std::size_t> ranks;
+
+    public:
+        explicit link_by_rank(const std::size_t n) : ranks(n, 0) {
+        }
+
+        void link(std::vector<std::size_t>& parents, std::size_t i, std::size_t j) noexcept {
+            if (ranks[i] < ranks[j]) {
+                std::swap(i, j);
+            }
+
+            parents[j] = i;
+
+            if (ranks[i] == ranks[j]) {
+                ++ranks[i];
+            }
+        }
+    };
+
+    // the root with the bigger index points to the root with the smaller index, so every parent
+    // has a smaller index than its children. It doesn't need any data, but the trees are
+    // balanced only if the labels are in random order
+    class link_by_index {
+    public:
+        explicit link_by_index(std::size_t) noexcept {
+        }
+
+        void link(std::vector<std::size_t>& parents, const std::size_t i,
+                  const std::size_t j) noexcept {
+            if (i < j) {
+                parents[j] = i;
+            } else {
+                parents[i] = j;
+            }
+        }
+
+        /**
+         * Rem's union-find algorithm with splicing: the paths from x and from y are climbed
+         * together, always moving up from the node with the bigger parent, so that x and y are
+         * recognized as connected as soon as the paths meet, without reaching the root.
+         * Every node that is left is spliced to the parent of the other path, which has a
+         * smaller index and which compresses the paths like path halving does.
+         * Return true iff the sets of x and y were distinct and they have been united.
+         * It relies on every parent having a smaller index than its children.
+         */
+        [[nodiscard]] static bool rem_unite(std::vector<std::size_t>& parents, std::size_t x,
+                                            std::size_t y) noexcept {
+            while (parents[x] != parents[y]) {
+                // x must be the node with the bigger parent
+                if (parents[x] < parents[y]) {
+                    std::swap(x, y);
+                }
+
+                if (x == parents[x]) {
+                    // x is a root: link it to the smaller parent of y
+                    parents[x] = parents[y];
+                    return true;
+                }
+
+                // splice x to the parent of y, and move up to the old parent of x
+                const auto parent = parents[x];
+                parents[x] = parents[y];
+                x = parent;
+            }
+
+            return false;
+        }
+    };
+
+    /**
+     * Compression rules. find(parents, x) returns the root of x, and it may shorten the path
+     * from x to the root.
+     */
+
+    // the path is left untouched
+    struct compress_none {
+        [[nodiscard]] static std::size_t find(std::vector<std::size_t>& parents,
+                                              std::size_t x) noexcept {
+            while (x != parents[x]) {
+                // move towards the parent
+                x = parents[x];
+            }
+
+            return x;
+        }
+    };
+
+    // every node in the path points directly to the root, which takes a second pass
+    struct compress_full {
+        [[nodiscard]] static std::size_t find(std::vector<std::size_t>& parents,
+                                              const std::size_t element) noexcept {
+            auto root = element;
+            while (root != parents[root]) {
+                root = parents[root];
+            }
+
+            for (auto x = element; x != root;) {
+                const auto parent = parents[x];
+                parents[x] = root;
+                x = parent;
+            }
+
+            return root;
+        }
+    };
+
+    // every other node in the path points to its grandparent
+    struct compress_halving {
+        [[nodiscard]] static std::size_t find(std::vector<std::size_t>& parents,
+                                              std::size_t x) noexcept {
+            while (x != parents[x]) {
+                // skip parent and point to grandparent
+                parents[x] = parents[parents[x]];
+
+                // move to grandparent
+                x = parents[x];
+            }
+
+            return x;
+        }
+    };
+
+    // every node in the path points to its grandparent
+    struct compress_splitting {
+        [[nodiscard]] static std::size_t find(std::vector<std::size_t>& parents,
+                                              std::size_t x) noexcept {
+            while (x != parents[x]) {
+                const auto parent = parents[x];
+
+                // skip parent and point to grandparent
+                parents[x] = parents[parent];
+
+                // move to the old parent
+                x = parent;
+            }
+
+            return x;
+        }
+    };
+
+    /**
+     * Disjoint-Set whose linking rule and compression rule are template parameters, so that
+     * every combination is resolved at compile time and it can be benchmarked on its own.
+     * BasicDisjointSet accepts element of type T, which must be an unsigned integer type.
+     *
+     * Link: link_by_size, link_by_rank or link_by_index.
+     * Compression: compress_none, compress_full, compress_halving or compress_splitting.
+     */
+    template <typename T, class Link, class Compression>
+    class BasicDisjointSet : public DisjointSetBase<BasicDisjointSet<T, Link, Compression>, T> {
+        using super = DisjointSetBase<BasicDisjointSet<T, Link, Compression>, T>;
+        using parameter_t = typename super::parameter_t;
+
+        // linking rule, with its data
+        Link linker;
+
+    public:
+        // x_list must contain unsigned integers of distinct value in the range [0, x_list.size())
+        explicit BasicDisjointSet(const std::vector<T>& x_list) :
+            super(x_list), linker(x_list.size()) {
+        }
+
+        ~BasicDisjointSet() = default;
+
+        /**
+         * Returns the index of the representative of the unique set containing the given item.
+         * T must be cast-able to size_t.
+         * O(logN) with compress_none and link_by_size or link_by_rank, O(lg*(N)) (basically
+         * linear, lg*(265536) == 5) with any other compression rule.
+         */
+        [[nodiscard]] std::size_t find(parameter_t element) noexcept {
+            return Compression::find(this->parents, element);
+        }
+
+        /**
+         * Unites the dynamic sets that contain x and y into a new set that is the union
+         * of these two sets, if they are distinct.
+         * Returns true iff the sets were distinct, so that a single call replaces
+         * are_connected(x, y) followed by unite(x, y), which would find both roots twice.
+         * With link_by_index it uses Rem's algorithm (see link_by_index::rem_unite), which
+         * stops as soon as the paths from x and y meet.
+         * The complexity of this method is the same of find + O(1)
+         */
+        [[nodiscard]] bool try_unite(parameter_t x, parameter_t y) noexcept {
+            if constexpr (std::is_same<Link, link_by_index>::value) {
+                return link_by_index::rem_unite(this->parents, x, y);
+            } else {
+                const auto i = find(x);
+                const auto j = find(y);
+
+                // if the two nodes are the same set, do nothing
+                if (i == j) {
+                    return false;
+                }
+
+                linker.link(this->parents, i, j);
+                return true;
+            }
+        }
+
+        /**
+         * Unites the dynamic sets that contain x and y into a new set that is the union
+         * of these two sets.
+         * x should be different than y.
+         * The complexity of this method is the same of find + O(1)
+         */
+        void unite(parameter_t x, parameter_t y) noexcept {
+            static_cast<void>(try_unite(x, y));
+        }
+    };
+
+}  // namespace disjoint_set
+
+#endif  // BASIC_DISJOINT_SET_H
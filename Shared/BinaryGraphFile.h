@@ -0,0 +1,174 @@
+#ifndef BINARY_GRAPH_FILE_H
+#define BINARY_GRAPH_FILE_H
+
+#include <cstdint>      // std::uint32_t, std::uint64_t
+#include <cstring>      // std::memcmp, std::memcpy
+#include <fstream>      // std::ofstream
+#include <stdexcept>    // std::runtime_error
+#include <string>       // std::string
+#include <type_traits>  // std::is_trivially_copyable
+#include <vector>       // std::vector
+
+#include "Edge.h"
+#include "MappedFile.h"
+
+/**
+ * Compact binary representation of a graph, meant to be converted once from the text format
+ * and then memory-mapped by every subsequent run.
+ *
+ * The file is a BinaryGraphHeader followed by m packed Edge<Label, Weight> records, stored in
+ * the native byte order and with the exact in-memory layout of Edge, so that the mapped
+ * records can be used in place without being parsed or copied. Labels are already 0-based.
+ * The header records the sizes of Label, Weight and Edge, and a byte order mark, so that a
+ * file written on an incompatible platform is rejected instead of being misread.
+ */
+namespace binary_graph {
+
+    // magic bytes at the beginning of every binary graph file
+    constexpr char magic[8] = {'M', 'S', 'T', 'G', 'R', 'A', 'P', 'H'};
+
+    // current version of the file format
+    constexpr std::uint32_t version = 1;
+
+    // written in the native byte order, it reads differently on a machine with another one
+    constexpr std::uint32_t byte_order_mark = 0x01020304;
+
+    /**
+     * Header of a binary graph file. It is 64 bytes long, so that the edge records that follow
+     * it are suitably aligned in a page-aligned memory mapping.
+     */
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byte_order_mark;
+        std::uint32_t label_size;
+        std::uint32_t weight_size;
+        std::uint32_t edge_size;
+        std::uint32_t reserved;
+        std::uint64_t n_vertex;
+        std::uint64_t n_edges;
+        std::uint8_t padding[16];
+    };
+
+    static_assert(sizeof(Header) == 64, "binary_graph::Header must be 64 bytes long");
+
+    // return the header that describes a graph with the given size and Label/Weight types
+    template <typename Label, typename Weight>
+    [[nodiscard]] Header make_header(const std::uint64_t n_vertex,
+                                     const std::uint64_t n_edges) noexcept {
+        Header header{};
+        std::memcpy(header.magic, magic, sizeof(magic));
+        header.version = version;
+        header.byte_order_mark = byte_order_mark;
+        header.label_size = sizeof(Label);
+        header.weight_size = sizeof(Weight);
+        header.edge_size = sizeof(Edge<Label, Weight>);
+        header.n_vertex = n_vertex;
+        header.n_edges = n_edges;
+        return header;
+    }
+
+    /**
+     * Write the given graph to path in the binary graph format.
+     * Throws std::runtime_error if the file can't be written.
+     * Time:  O(m)
+     * Space: O(1)
+     */
+    template <typename Label, typename Weight>
+    void write(const std::string& path, const std::size_t n_vertex,
+               const std::vector<Edge<Label, Weight>>& edges) {
+        static_assert(std::is_trivially_copyable<Edge<Label, Weight>>::value,
+                      "Edge must be trivially copyable to be stored in a binary graph file");
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("binary_graph::write: cannot open '" + path + "'");
+        }
+
+        const auto header = make_header<Label, Weight>(n_vertex, edges.size());
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(edges.data()),
+                   static_cast<std::streamsize>(edges.size() * sizeof(Edge<Label, Weight>)));
+
+        if (!file) {
+            throw std::runtime_error("binary_graph::write: cannot write '" + path + "'");
+        }
+    }
+
+}  // namespace binary_graph
+
+/**
+ * Read-only, zero-copy view over a memory-mapped binary graph file.
+ * The edges returned by begin() and end() point directly into the mapping, so they must not
+ * outlive the MappedEdgeList object.
+ * Throws std::runtime_error if the file can't be mapped, if it has been written with an
+ * incompatible Label, Weight or byte order, or if an edge has a label that isn't lower than the
+ * number of vertexes. Checking the labels takes a sequential O(m) pass over the mapping.
+ */
+template <typename Label, typename Weight>
+class MappedEdgeList {
+    MappedFile mapping;
+    const binary_graph::Header* header;
+
+    [[noreturn]] static void fail(const std::string& path, const char* what) {
+        throw std::runtime_error("MappedEdgeList: " + std::string(what) + " '" + path + "'");
+    }
+
+public:
+    explicit MappedEdgeList(const std::string& path) : mapping(path) {
+        if (mapping.size() < sizeof(binary_graph::Header)) {
+            fail(path, "truncated header in");
+        }
+
+        header = reinterpret_cast<const binary_graph::Header*>(mapping.data());
+        const auto expected = binary_graph::make_header<Label, Weight>(0, 0);
+
+        if (std::memcmp(header->magic, binary_graph::magic, sizeof(binary_graph::magic)) != 0 ||
+            header->version != expected.version) {
+            fail(path, "not a binary graph file");
+        }
+
+        if (header->byte_order_mark != expected.byte_order_mark ||
+            header->label_size != expected.label_size ||
+            header->weight_size != expected.weight_size ||
+            header->edge_size != expected.edge_size) {
+            fail(path, "incompatible Label/Weight layout in");
+        }
+
+        const auto data_size = mapping.size() - sizeof(binary_graph::Header);
+        if (data_size / sizeof(Edge<Label, Weight>) < header->n_edges) {
+            fail(path, "truncated edge list in");
+        }
+
+        // the graphs index their arrays by label, so a corrupted edge must not get that far
+        const auto n = header->n_vertex;
+        for (auto it = begin(); it != end(); ++it) {
+            if (it->from >= n || it->to >= n) {
+                fail(path, "edge with a label out of range in");
+            }
+        }
+    }
+
+    // return the number of vertexes declared in the header
+    [[nodiscard]] std::size_t vertexes_size() const noexcept {
+        return static_cast<std::size_t>(header->n_vertex);
+    }
+
+    // return the number of edges stored in the file
+    [[nodiscard]] std::size_t size() const noexcept {
+        return static_cast<std::size_t>(header->n_edges);
+    }
+
+    // return a pointer to the first edge, inside the mapping
+    [[nodiscard]] const Edge<Label, Weight>* begin() const noexcept {
+        return reinterpret_cast<const Edge<Label, Weight>*>(mapping.data() +
+                                                            sizeof(binary_graph::Header));
+    }
+
+    // return a pointer past the last edge, inside the mapping
+    [[nodiscard]] const Edge<Label, Weight>* end() const noexcept {
+        return begin() + size();
+    }
+};
+
+#endif  // BINARY_GRAPH_FILE_H
@@ -1,7 +1,8 @@
 #ifndef BINARY_HEAP_H
 #define BINARY_HEAP_H
 
-#include <vector>  // std::vector
+#include <functional>  // std::greater, std::less
+#include <vector>      // std::vector
 
 #include "Heap.h"
 
@@ -17,10 +18,31 @@ namespace heap {
      * IsAlreadyHeap: constexpr bool flag. If true, build_heap() won't be called
      *                after the class is constructed.
      *                If false, the given vector is considered an already valid heap.
+     * Compare: comparison functor, std::greater<> for a Min Heap, std::less<> for a Max Heap.
+     * Derived: void, or the class that derives BinaryHeap to customize compare(a, b) and
+     *          swap_nodes(i, j), like PriorityQueue does.
      */
-    template <typename T, bool IsAlreadyHeap = false>
-    class BinaryHeap : public Heap<T, IsAlreadyHeap> {
-        using super = Heap<T, IsAlreadyHeap>;
+    template <typename T, bool IsAlreadyHeap = false, class Compare = std::greater<>,
+              class Derived = void>
+    class BinaryHeap;
+
+    namespace detail {
+        // CRTP base class of BinaryHeap
+        template <typename T, bool IsAlreadyHeap, class Compare, class Derived>
+        using binary_heap_base =
+            Heap<derived_or_self_t<Derived, BinaryHeap<T, IsAlreadyHeap, Compare, Derived>>, T,
+                 Compare, IsAlreadyHeap>;
+    }  // namespace detail
+
+    template <typename T, bool IsAlreadyHeap, class Compare, class Derived>
+    class BinaryHeap : public detail::binary_heap_base<T, IsAlreadyHeap, Compare, Derived> {
+    protected:
+        using heap_base = detail::binary_heap_base<T, IsAlreadyHeap, Compare, Derived>;
+
+    private:
+        using super = heap_base;
+        friend heap_base;
+
         // returns the left child of nodes[i]
         [[nodiscard]] static std::size_t left(const std::size_t i) noexcept {
             return (i << 1) + 1;
@@ -37,26 +59,29 @@ namespace heap {
         }
 
     protected:
-        using compare_t = typename super::compare_t;
-
-        // protected constructor to let the subclass set the comparator after the initialization
-        explicit BinaryHeap(const std::vector<T>& inputs) noexcept : super(inputs) {
+        // protected constructor to let the subclass initialize the data used by its comparator
+        // before the heap is built
+        explicit BinaryHeap(const std::vector<T>& inputs, detail::deferred_init_t) :
+            super(inputs, Compare()) {
         }
 
-        // protected constructor to let the subclass set the comparator after the initialization
-        explicit BinaryHeap(std::vector<T>&& inputs) noexcept : super(std::move(inputs)) {
+        // protected constructor to let the subclass initialize the data used by its comparator
+        // before the heap is built
+        explicit BinaryHeap(std::vector<T>&& inputs, detail::deferred_init_t) noexcept :
+            super(std::move(inputs), Compare()) {
         }
 
         // return the parent of nodes[i]
-        [[nodiscard]] std::size_t parent(const std::size_t i) const noexcept override final {
+        [[nodiscard]] static std::size_t parent(const std::size_t i) noexcept {
             return (i - 1) >> 1;
         }
 
         // starting from a Heap with a misplaced node at the given index,
         // recover the shape and heap properties bubbling the node down
-        void heapify_down(const std::size_t index_to_fix) noexcept override {
+        void heapify_down(const std::size_t index_to_fix) noexcept {
             const std::size_t len = this->size();
             std::size_t i = index_to_fix;
+            auto& self = this->derived();
 
             while (!is_leaf(i)) {
                 const auto l = left(i);
@@ -66,10 +91,10 @@ namespace heap {
                 // or the smallest element in a Min Heap
                 std::size_t comp_est = i;
 
-                if (l < len && this->comp(this->nodes.at(i), this->nodes.at(l))) {
+                if (l < len && self.compare(this->nodes[i], this->nodes[l])) {
                     comp_est = l;
                 }
-                if (r < len && this->comp(this->nodes.at(comp_est), this->nodes.at(r))) {
+                if (r < len && self.compare(this->nodes[comp_est], this->nodes[r])) {
                     comp_est = r;
                 }
 
@@ -77,57 +102,61 @@ namespace heap {
                     return;
                 }
 
-                this->swap_nodes(i, comp_est);
+                self.swap_nodes(i, comp_est);
                 i = comp_est;
             }
         }
 
         // transform the internal vector in a heap in O(n)
-        void build_heap() noexcept override final {
+        void build_heap() noexcept {
             for (std::size_t i = (this->size() >> 1) + 1; i > 0; --i) {
                 heapify_down(i - 1);
             }
         }
 
     public:
+        // the same heap, with another comparator and another derived class
+        template <class OtherCompare, class OtherDerived>
+        using rebind = BinaryHeap<T, IsAlreadyHeap, OtherCompare, OtherDerived>;
+
         // disable public default constructor
         BinaryHeap() = delete;
 
-        explicit BinaryHeap(const std::vector<T>& inputs, compare_t&& comp) noexcept :
-            super(inputs, std::move(comp)) {
+        explicit BinaryHeap(const std::vector<T>& inputs, const Compare& comp = Compare()) :
+            super(inputs, comp) {
             this->init();
         }
 
-        explicit BinaryHeap(std::vector<T>&& inputs, compare_t&& comp) noexcept :
-            super(std::move(inputs), std::move(comp)) {
+        explicit BinaryHeap(std::vector<T>&& inputs, const Compare& comp = Compare()) noexcept :
+            super(std::move(inputs), comp) {
             this->init();
         }
 
-        virtual ~BinaryHeap() = default;
+        ~BinaryHeap() = default;
     };
 
     // create a Min Heap copying the input vector
     template <bool IsAlreadyHeap = false, typename T>
     auto make_min_heap(const std::vector<T>& inputs) {
-        return BinaryHeap<T, IsAlreadyHeap>(inputs, std::greater<>{});
+        return BinaryHeap<T, IsAlreadyHeap, std::greater<>>(inputs);
     }
 
     // create a Min Heap moving the input vector
     template <bool IsAlreadyHeap = false, typename T>
     auto make_min_heap(std::vector<T>&& inputs = {}) {
-        return BinaryHeap<T, IsAlreadyHeap>(std::move(inputs), std::greater<>{});
+        return BinaryHeap<T, IsAlreadyHeap, std::greater<>>(std::move(inputs));
     }
 
     // create a Max Heap copying the input vector
     template <bool IsAlreadyHeap = false, typename T>
     auto make_max_heap(const std::vector<T>& inputs) {
-        return BinaryHeap<T, IsAlreadyHeap>(inputs, std::less<>{});
+        return BinaryHeap<T, IsAlreadyHeap, std::less<>>(inputs);
     }
 
     // create a Max Heap moving the input vector
     template <bool IsAlreadyHeap = false, typename T>
     auto make_max_heap(std::vector<T>&& inputs = {}) {
-        return BinaryHeap<T, IsAlreadyHeap>(std::move(inputs), std::less<>{});
+        return BinaryHeap<T, IsAlreadyHeap, std::less<>>(std::move(inputs));
     }
 
 }  // namespace heap
@@ -0,0 +1,291 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include <algorithm>  // std::sort, std::lower_bound, std::max
+#include <numeric>    // std::iota
+#include <utility>    // std::pair
+#include <vector>     // std::vector
+
+#include "Edge.h"
+#include "sort_by_weight.h"
+
+/**
+ * Compressed Sparse Row class for undirected weighted graphs.
+ * The neighbours of every vertex are packed in a single contiguous array, and the slice of
+ * the array that belongs to vertex v is [offsets[v], offsets[v + 1]). Compared to
+ * AdjacencyMapGraph, iterating over the neighbours of a vertex is a linear scan over
+ * contiguous memory instead of a traversal of hash-node linked lists.
+ * The graph is immutable: it is built once from a list of edges.
+ * The given nodes must be labeled as unsigned numbers x, where 0 <= x < n.
+ *
+ * Label is the type of a node label, which must be an unsigned integer.
+ * Weight is the type of an edge weight, which must be a signed integer.
+ */
+template <typename Label, typename Weight>
+class CSRGraph {
+public:
+    // (vertex, weight) pair, laid out like the entries of AdjacencyMapGraph::adjacent_vertexes
+    // so that both graphs can be traversed with the same structured bindings.
+    using neighbour_t = std::pair<Label, Weight>;
+
+    /**
+     * Read-only view over the neighbours of a single vertex.
+     */
+    class neighbour_range {
+        const neighbour_t* first;
+        const neighbour_t* last;
+
+    public:
+        neighbour_range(const neighbour_t* first, const neighbour_t* last) noexcept :
+            first(first), last(last) {
+        }
+
+        [[nodiscard]] const neighbour_t* begin() const noexcept {
+            return first;
+        }
+
+        [[nodiscard]] const neighbour_t* end() const noexcept {
+            return last;
+        }
+
+        [[nodiscard]] size_t size() const noexcept {
+            return static_cast<size_t>(last - first);
+        }
+    };
+
+private:
+    /**
+     * offsets[v] is the index in neighbours of the first neighbour of v.
+     * offsets has n + 1 entries, the last one being the size of neighbours.
+     */
+    std::vector<size_t> offsets;
+
+    /**
+     * (vertex, weight) pairs of every vertex, sorted by vertex within each slice.
+     * Every undirected edge is stored twice, once for each of its end nodes.
+     */
+    std::vector<neighbour_t> neighbours;
+
+    /**
+     * Initializes the graph starting from the array of edges [first, last) with a counting pass
+     * followed by a scatter pass.
+     * Self loops are discarded, and parallel edges are merged keeping the lowest weight, like
+     * AdjacencyMapGraph::add_edge does.
+     * Time:  O(n + m*log(d)), where d is the maximum degree of a vertex
+     * Space: O(n + m)
+     */
+    void init(const Edge<Label, Weight>* first, const Edge<Label, Weight>* last, size_t n_vertex);
+
+public:
+    /**
+     * Creates a graph representation starting from a vector of edges.
+     * If n_vertex is 0, the number of vertexes is inferred from the highest label.
+     * Time:  O(n + m*log(d))
+     * Space: O(n + m)
+     */
+    explicit CSRGraph(std::vector<Edge<Label, Weight>>&& edge_list, const size_t n_vertex = 0) {
+        init(edge_list.data(), edge_list.data() + edge_list.size(), n_vertex);
+    }
+
+    /**
+     * Creates a graph representation starting from the array of edges [first, last), which is
+     * only read during the construction. This lets the graph be built straight out of a
+     * memory-mapped file.
+     * Time:  O(n + m*log(d))
+     * Space: O(n + m)
+     */
+    explicit CSRGraph(const Edge<Label, Weight>* first, const Edge<Label, Weight>* last,
+                      const size_t n_vertex = 0) {
+        init(first, last, n_vertex);
+    }
+
+    /**
+     * Return the number of vertexes stored.
+     * Time:  O(1)
+     * Space: O(1)
+     */
+    [[nodiscard]] size_t vertexes_size() const noexcept;
+
+    /**
+     * Return the number of distinct undirected edges stored.
+     * Time:  O(1)
+     * Space: O(1)
+     */
+    [[nodiscard]] size_t edges_size() const noexcept;
+
+    /**
+     * Return the list of vertexes, i.e. [0, n).
+     * Time:  O(n)
+     * Space: O(n)
+     */
+    [[nodiscard]] std::vector<Label> get_vertexes() const;
+
+    /**
+     * Return the list of edges. Every edge is reported once, with from < to.
+     * Time:  O(n + m)
+     * Space: O(m)
+     */
+    [[nodiscard]] std::vector<Edge<Label, Weight>> get_edges() const;
+
+    /**
+     * Return the list of edges sorted by weight according to the given comparator.
+     * Integral weights are radix sorted on n_threads threads, see sort_by_weight.
+     * Time:  O(n + m/p) with p threads for integral weights ordered by std::less or
+     *        std::greater, O(n + mlogm) otherwise
+     * Space: O(m)
+     */
+    template <class Comparator>
+    [[nodiscard]] std::vector<Edge<Label, Weight>> get_sorted_edges(
+        Comparator&& comparator, std::size_t n_threads = 1) const;
+
+    /**
+     * Return true iff the given vertex is in the graph.
+     * Time:  O(1)
+     * Space: O(1)
+     */
+    [[nodiscard]] bool has_vertex(const Label& vertex) const noexcept;
+
+    /**
+     * Return true iff the given edge is in the graph.
+     * Time:  O(log(d))
+     * Space: O(1)
+     */
+    [[nodiscard]] bool has_edge(const Label& from, const Label& to) const noexcept;
+
+    /**
+     * Return the (vertex, weight) pairs adjacent to the given vertex.
+     * Time:  O(1)
+     * Space: O(1)
+     */
+    [[nodiscard]] neighbour_range adjacent_vertexes(const Label& vertex) const noexcept;
+};
+
+template <typename Label, typename Weight>
+inline void CSRGraph<Label, Weight>::init(const Edge<Label, Weight>* first,
+                                          const Edge<Label, Weight>* last, size_t n_vertex) {
+    for (auto it = first; it != last; ++it) {
+        const auto& [from, to, _] = *it;
+        n_vertex = std::max(n_vertex, static_cast<size_t>(std::max(from, to)) + 1);
+    }
+
+    // count the degree of every vertex, shifted by one position so that the prefix sum
+    // computed right after turns degrees into offsets
+    offsets.assign(n_vertex + 1, 0);
+    for (auto it = first; it != last; ++it) {
+        const auto& [from, to, _] = *it;
+        if (from != to) {
+            ++offsets[from + 1];
+            ++offsets[to + 1];
+        }
+    }
+
+    for (size_t v = 0; v < n_vertex; ++v) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    // scatter every edge in the slices of both its end nodes. cursor[v] is the next free
+    // slot in the slice of v.
+    std::vector<size_t> cursor(offsets.cbegin(), offsets.cend() - 1);
+    neighbours.resize(offsets.back());
+    for (auto it = first; it != last; ++it) {
+        const auto& [from, to, weight] = *it;
+        if (from != to) {
+            neighbours[cursor[from]++] = {to, weight};
+            neighbours[cursor[to]++] = {from, weight};
+        }
+    }
+
+    // sort every slice by (vertex, weight) and compact it in place, keeping only the lightest
+    // of any group of parallel edges. The slices only shrink, so the write index never
+    // overtakes the read index.
+    size_t write = 0;
+    for (size_t v = 0; v < n_vertex; ++v) {
+        const auto slice_first = neighbours.begin() + offsets[v];
+        const auto slice_last = neighbours.begin() + offsets[v + 1];
+        std::sort(slice_first, slice_last);
+
+        offsets[v] = write;
+        for (auto it = slice_first; it != slice_last; ++it) {
+            if (write == offsets[v] || neighbours[write - 1].first != it->first) {
+                neighbours[write++] = *it;
+            }
+        }
+    }
+    offsets[n_vertex] = write;
+
+    neighbours.resize(write);
+    neighbours.shrink_to_fit();
+}
+
+template <typename Label, typename Weight>
+inline size_t CSRGraph<Label, Weight>::vertexes_size() const noexcept {
+    return offsets.size() - 1;
+}
+
+template <typename Label, typename Weight>
+inline size_t CSRGraph<Label, Weight>::edges_size() const noexcept {
+    return neighbours.size() / 2;
+}
+
+template <typename Label, typename Weight>
+inline std::vector<Label> CSRGraph<Label, Weight>::get_vertexes() const {
+    std::vector<Label> vertexes(vertexes_size());
+    std::iota(vertexes.begin(), vertexes.end(), Label(0));
+    return vertexes;
+}
+
+template <typename Label, typename Weight>
+inline std::vector<Edge<Label, Weight>> CSRGraph<Label, Weight>::get_edges() const {
+    std::vector<Edge<Label, Weight>> edges;
+    edges.reserve(edges_size());
+
+    const size_t n = vertexes_size();
+    for (size_t from = 0; from < n; ++from) {
+        for (const auto& [to, weight] : adjacent_vertexes(from)) {
+            // every edge is stored twice, report only the copy with from < to
+            if (from < to) {
+                edges.emplace_back(from, to, weight);
+            }
+        }
+    }
+
+    return edges;
+}
+
+template <typename Label, typename Weight>
+template <class Comparator>
+inline std::vector<Edge<Label, Weight>> CSRGraph<Label, Weight>::get_sorted_edges(
+    Comparator&& comparator, const std::size_t n_threads) const {
+    auto sorted_edges = get_edges();
+    sort_by_weight(sorted_edges, std::forward<Comparator>(comparator), n_threads);
+    return sorted_edges;
+}
+
+template <typename Label, typename Weight>
+inline bool CSRGraph<Label, Weight>::has_vertex(const Label& vertex) const noexcept {
+    return vertex < vertexes_size();
+}
+
+template <typename Label, typename Weight>
+inline bool CSRGraph<Label, Weight>::has_edge(const Label& from, const Label& to) const noexcept {
+    if (!has_vertex(from)) {
+        return false;
+    }
+
+    // slices are sorted by vertex, so we can binary search the target vertex
+    const auto range = adjacent_vertexes(from);
+    const auto it = std::lower_bound(range.begin(), range.end(), to,
+                                     [](const neighbour_t& neighbour, const Label& label) {
+                                         return neighbour.first < label;
+                                     });
+    return it != range.end() && it->first == to;
+}
+
+template <typename Label, typename Weight>
+inline typename CSRGraph<Label, Weight>::neighbour_range CSRGraph<Label, Weight>::adjacent_vertexes(
+    const Label& vertex) const noexcept {
+    const neighbour_t* data = neighbours.data();
+    return {data + offsets[vertex], data + offsets[vertex + 1]};
+}
+
+#endif  // CSR_GRAPH_H
@@ -1,60 +1,134 @@
 #pragma once
 
+#include <algorithm>      // std::fill
+#include <cstdint>        // std::uint32_t
 #include <limits>         // std::numeric_limits
 #include <stack>          // std::stack
 #include <unordered_set>  // std::unordered_set
 #include <utility>        // std::pair
+#include <vector>         // std::vector
 
 #include "AdjacencyMapGraph.h"
 
 /**
- * Utility class to detect cycles in a graph using Depth First Search
+ * Utility class to detect whether an edge would close a cycle in a forest.
+ * are_connected(u, v), which is the method in use, runs a bidirectional Breadth First Search
+ * from u and from v (see are_connected_helper). The deprecated has_cycle and
+ * are_connected_helper_rec, which are kept for reference, are the Depth First Searches the class
+ * is named after.
+ * The vertexes of the graph must be labeled in the range [0, n), where n is the number of
+ * vertexes.
  */
 template <typename Label, typename Weight>
 class DFSCycleDetection {
     // constant pointer to a non constant graph represented as an Adjacency Map
     AdjacencyMapGraph<Label, Weight>* const adj_map_graph_ptr;
 
-    // return true iff there exist a path that links the source and target vertexes.
-    // This method assumes that the underlying graph doesn't have any cycle.
-    bool are_connected_helper(const Label& source, const Label& target,
-                              std::unordered_set<Label>& visited) const {
-        // mark the source node as visited
-        visited.insert(source);
+    /**
+     * visited[v] == epoch iff v has been reached from the source by the current search, and
+     * visited[v] == epoch + 1 iff it has been reached from the target. Every search adds 2 to
+     * epoch instead of clearing visited, so no memory is allocated or cleared between searches.
+     * They are scratch data which don't change the observable state of the object, hence they
+     * are mutable.
+     */
+    mutable std::vector<std::uint32_t> visited;
+    mutable std::uint32_t epoch = 0;
+
+    // frontiers of the searches from the source and from the target, and the next level of the
+    // frontier being expanded. Their capacity is reused by the next searches
+    mutable std::vector<Label> source_frontier;
+    mutable std::vector<Label> target_frontier;
+    mutable std::vector<Label> next_frontier;
+
+    // start a new search: the vertexes visited by the previous searches are forgotten in O(1)
+    // amortized time
+    void new_search() const {
+        const auto n = adj_map_graph_ptr->vertexes_size();
+        if (visited.size() < n) {
+            visited.resize(n, 0);
+            source_frontier.reserve(n);
+            target_frontier.reserve(n);
+            next_frontier.reserve(n);
+        }
 
-        // the source node will be the first to be processed
-        std::stack<Label> stack;
-        stack.push(source);
+        // restart from 0 before an overflow, when no stale mark can be mistaken for a new one
+        if (epoch > std::numeric_limits<std::uint32_t>::max() - 4) {
+            std::fill(visited.begin(), visited.end(), 0);
+            epoch = 0;
+        }
+        epoch += 2;
 
-        while (!stack.empty()) {
-            const auto curr_source = stack.top();
-            stack.pop();
+        source_frontier.clear();
+        target_frontier.clear();
+    }
 
-            // if the current source vertex is the same as the target vertex, or if it is
-            // directly linked to the target node, then source and target are connected
-            if (curr_source == target || adj_map_graph_ptr->has_edge(curr_source, target)) {
-                return true;
+    // visit the neighbors of the vertexes in frontier that haven't been reached by this side of
+    // the search yet, and replace frontier with them.
+    // Return true iff one of them has already been reached by the other side of the search.
+    bool expand(std::vector<Label>& frontier, const std::uint32_t mark,
+                const std::uint32_t other_mark) const {
+        next_frontier.clear();
+
+        for (const auto v : frontier) {
+            // there may not be any edge in the graph containing v
+            const auto adj_it = adj_map_graph_ptr->adj_map.find(v);
+            if (adj_it == adj_map_graph_ptr->adj_map.cend()) {
+                continue;
             }
 
-            // there may not be any edge in the graph containing the current source vertex
-            if (adj_map_graph_ptr->has_vertex(curr_source)) {
-                // visit the neighbors of the current source vertex
-                for (const auto& [u, _] : adj_map_graph_ptr->adj_map.at(curr_source)) {
-                    // we shouldn't consider any path that touches vertexes we already met
-                    // previously, as they don't provide a path to reach the target node.
-                    if (!visited.count(u)) {
-                        visited.insert(u);
-                        stack.push(u);
-                    }
+            for (const auto& [u, _] : adj_it->second) {
+                if (visited[u] == other_mark) {
+                    return true;
+                }
+
+                // we shouldn't consider any path that touches vertexes we already met
+                // previously, as they don't provide a path to reach the other side.
+                if (visited[u] != mark) {
+                    visited[u] = mark;
+                    next_frontier.push_back(u);
                 }
             }
         }
 
+        frontier.swap(next_frontier);
         return false;
     }
 
-    // this method is left here for reference. are_connected_helper is ~100% faster than
-    // are_connected_helper_rec
+    // return true iff there exist a path that links the source and target vertexes.
+    // The searches from source and from target advance one level at a time, and the smaller
+    // frontier is always expanded first. They stop as soon as they meet, or as soon as one of
+    // them has visited its whole connected component.
+    // This method assumes that the underlying graph doesn't have any cycle: every component
+    // is a tree, so the work is bounded by the size of the smaller side.
+    bool are_connected_helper(const Label& source, const Label& target) const {
+        if (source == target) {
+            return true;
+        }
+
+        new_search();
+        const auto source_mark = epoch;
+        const auto target_mark = epoch + 1;
+
+        visited[source] = source_mark;
+        visited[target] = target_mark;
+        source_frontier.push_back(source);
+        target_frontier.push_back(target);
+
+        while (!source_frontier.empty() && !target_frontier.empty()) {
+            const bool met = source_frontier.size() <= target_frontier.size()
+                                 ? expand(source_frontier, source_mark, target_mark)
+                                 : expand(target_frontier, target_mark, source_mark);
+            if (met) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // this method is left here for reference: it's the recursive Depth First Search that
+    // are_connected used before the bidirectional Breadth First Search of are_connected_helper,
+    // whose work is bounded by the size of the smaller of the 2 trees instead of the bigger one
     [[deprecated("use are_connected_helper instead")]] bool are_connected_helper_rec(
         const Label& source, const Label& target, std::unordered_set<Label>& visited) const {
         if (source == target || adj_map_graph_ptr->has_edge(source, target)) {
@@ -161,17 +235,13 @@ public:
     /**
      * Returns true iff there is a path from the source vertex to the target vertex in the graph
      * pointed by adj_map_graph_ptr.
+     * The visited array and the frontiers are reused by every call, so it doesn't allocate
+     * memory unless the graph has grown.
      * Time: O(n + m)
-     * Space: O(n)
+     * Space: O(n), allocated only once
      */
     bool are_connected(const Label& source, const Label& target) const {
-        const auto n = adj_map_graph_ptr->vertexes_size();
-
-        // set that keeps track of the visited nodes
-        std::unordered_set<Label> visited;
-        visited.reserve(n);
-
-        return are_connected_helper(source, target, visited);
+        return are_connected_helper(source, target);
     }
 
     /**
@@ -0,0 +1,163 @@
+#ifndef DISJOINT_SET_CONCURRENT_H
+#define DISJOINT_SET_CONCURRENT_H
+
+#include <atomic>       // std::atomic, std::memory_order_acquire, std::memory_order_release
+#include <cstdint>      // std::uint64_t
+#include <type_traits>  // std::enable_if, std::is_unsigned, std::conditional, std::is_arithmetic
+#include <utility>      // std::swap
+#include <vector>       // std::vector
+
+namespace disjoint_set {
+
+    /**
+     * Lock-free Disjoint-Set that can be shared by many threads, which can call find, unite,
+     * try_unite and are_connected concurrently.
+     * Every parent is a std::atomic word. A root is linked to another root with a single CAS, which
+     * fails if a concurrent unite has already linked it, in which case the roots are found again.
+     * Roots are linked by random index: the root with the lowest priority, a pseudo-random
+     * permutation of the indexes, becomes the child of the other one. Unlike union by rank, this
+     * doesn't need any other shared word per element, and it keeps the trees O(logN) deep in
+     * expectation.
+     * find implements path halving, where every CAS that fails is simply skipped, so it never
+     * waits for the other threads.
+     *
+     * It exposes the same interface of DisjointSetBase, but it doesn't derive from it because
+     * parents must be atomic.
+     * DisjointSetConcurrent accepts element of type T, which must be an unsigned integer type.
+     */
+    template <typename T, typename = typename std::enable_if<std::is_unsigned<T>::value>::type>
+    class DisjointSetConcurrent {
+        // pass by constant value if type T is a simple arithmetic type, otherwise pass by const
+        // reference.
+        using parameter_t =
+            typename std::conditional<std::is_arithmetic<T>::value, const T, const T&>::type;
+
+        // vector that keeps track of the parent of every element in the DisjointSet
+        std::vector<std::atomic<std::size_t>> parents;
+
+        // return the linking priority of the given root. It's a bijection, so 2 different roots
+        // never have the same priority (splitmix64 finalizer)
+        [[nodiscard]] static std::uint64_t priority(const std::size_t x) noexcept {
+            auto z = static_cast<std::uint64_t>(x) + 0x9E3779B97F4A7C15ULL;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        // initially every item is the parent of itself
+        void init(const std::size_t size) noexcept {
+            for (std::size_t x = 0; x < size; ++x) {
+                parents[x].store(x, std::memory_order_relaxed);
+            }
+        }
+
+    public:
+        // x_list must contain unsigned integers of distinct value in the range [0, x_list.size())
+        explicit DisjointSetConcurrent(const std::vector<T>& x_list) : parents(x_list.size()) {
+            init(x_list.size());
+        }
+
+        ~DisjointSetConcurrent() = default;
+
+        /**
+         * Returns the index of the representative of the unique set containing the given item.
+         * If other threads are uniting sets at the same time, the result may already be outdated
+         * when it's returned.
+         * find implements path compression via path halving: every other node in the path is
+         * made to point to its grandparent with a CAS, which is skipped if it fails.
+         * O(logN) expected
+         */
+        [[nodiscard]] std::size_t find(parameter_t element) noexcept {
+            std::size_t x = element;
+
+            while (true) {
+                auto parent = parents[x].load(std::memory_order_acquire);
+                if (parent == x) {
+                    return x;
+                }
+
+                const auto grandparent = parents[parent].load(std::memory_order_acquire);
+                if (parent != grandparent) {
+                    // parents only move towards the root, so grandparent is still an ancestor
+                    // of x even if another thread has changed the parent of x in the meantime
+                    parents[x].compare_exchange_weak(parent, grandparent,
+                                                     std::memory_order_release,
+                                                     std::memory_order_relaxed);
+                }
+
+                x = grandparent;
+            }
+        }
+
+        /**
+         * Unites the dynamic sets that contain x and y into a new set that is the union
+         * of these two sets.
+         * Returns true iff this call merged 2 different sets, false if x and y were already in
+         * the same set. When many threads try to unite the same 2 sets, only one of them
+         * returns true.
+         * The complexity of this method is the same of find + O(1), plus a retry every time
+         * another thread links one of the roots first.
+         */
+        [[nodiscard]] bool try_unite(parameter_t x, parameter_t y) noexcept {
+            std::size_t i = x;
+            std::size_t j = y;
+
+            while (true) {
+                i = find(i);
+                j = find(j);
+
+                if (i == j) {
+                    return false;
+                }
+
+                // i must become the child of j
+                if (priority(i) > priority(j)) {
+                    std::swap(i, j);
+                }
+
+                // fails iff i isn't a root anymore
+                auto expected = i;
+                if (parents[i].compare_exchange_strong(expected, j, std::memory_order_acq_rel,
+                                                       std::memory_order_acquire)) {
+                    return true;
+                }
+            }
+        }
+
+        /**
+         * Unites the dynamic sets that contain x and y into a new set that is the union
+         * of these two sets.
+         * See try_unite.
+         */
+        void unite(parameter_t x, parameter_t y) noexcept {
+            static_cast<void>(try_unite(x, y));
+        }
+
+        /**
+         * returns true iff elements x and y are in the same set.
+         * The roots of x and y may be linked by other threads while they are being found: x
+         * and y are in different sets only if the root of x is still a root after the root of y
+         * has been found.
+         */
+        [[nodiscard]] bool are_connected(parameter_t x, parameter_t y) noexcept {
+            std::size_t i = x;
+            std::size_t j = y;
+
+            while (true) {
+                i = find(i);
+                j = find(j);
+
+                if (i == j) {
+                    return true;
+                }
+
+                if (parents[i].load(std::memory_order_acquire) == i) {
+                    return false;
+                }
+            }
+        }
+    };
+
+}  // namespace disjoint_set
+
+#endif  // DISJOINT_SET_CONCURRENT_H
@@ -0,0 +1,352 @@
+#ifndef DYNAMIC_MST_H
+#define DYNAMIC_MST_H
+
+#include <algorithm>      // std::fill
+#include <array>          // std::array
+#include <cassert>        // std::assert
+#include <cstdint>        // std::uint32_t
+#include <limits>         // std::numeric_limits
+#include <unordered_map>  // std::unordered_map
+#include <utility>        // std::pair
+#include <vector>         // std::vector
+
+#include "AdjacencyMapGraph.h"
+#include "Edge.h"
+#include "LinkCutTree.h"
+
+/**
+ * Minimum Spanning Forest of a graph over the vertexes [0, n) which is kept valid while edges
+ * are inserted, removed, and change their weight, without ever being recomputed from scratch.
+ * The graph is stored in an AdjacencyMapGraph, and the forest in a link-cut tree.
+ * - An edge that becomes lighter, either because it's new or because its weight decreased,
+ *   replaces the heaviest edge on the cycle it closes if it's lighter than it, like in
+ *   IncrementalMST. It takes O(logn) amortized time.
+ * - A tree edge that is removed or becomes heavier is cut from the forest, which splits its tree
+ *   in 2 sides. The lightest edge that crosses the cut, if any, reconnects them. The crossing
+ *   edges are the ones that leave the smaller side, which is found by visiting the 2 sides
+ *   alternately on the forest edges only, one tree adjacency entry at a time, until one of them
+ *   is complete. A side of s vertexes has 2(s - 1) tree adjacency entries, so the visit costs
+ *   O(s) on both sides, whatever the degrees of the vertexes of the larger one. The crossing
+ *   edges are then found among the graph edges of the smaller side. It takes O(s + d + logn)
+ *   time, where s is the number of vertexes of the smaller side and d is the sum of their
+ *   degrees in the graph.
+ * - Removing a non-tree edge, or making it heavier, doesn't change the forest.
+ * This is a simpler scheme than the polylogarithmic structure of Holm, de Lichtenberg and Thorup,
+ * which bounds the cost of a replacement search even when both sides are big.
+ *
+ * Label: type of the vertexes, which must be an unsigned integer type.
+ * Weight: type of the weights of the edges, which must be a signed integer type.
+ */
+template <typename Label, typename Weight>
+class DynamicMST {
+    using edge_id = typename dynamic_tree::LinkCutTree<Label, Weight>::edge_id;
+
+    // current graph
+    AdjacencyMapGraph<Label, Weight> graph;
+
+    // current forest
+    dynamic_tree::LinkCutTree<Label, Weight> forest;
+
+    // tree_ids[edge] -> identifier in forest of a tree edge. Edges are hashed and compared
+    // regardless of their weight and direction, so any (from, to, *) finds the tree edge
+    std::unordered_map<Edge<Label, Weight>, edge_id, custom_hash::edge_hash> tree_ids;
+
+    // edges of the current forest, in no particular order
+    std::vector<Edge<Label, Weight>> tree;
+
+    // positions[id] -> index in tree of the edge identified by id in forest
+    std::vector<std::size_t> positions;
+
+    // tree_adjacency[v] -> (neighbour, identifier in forest) of every tree edge of v
+    std::vector<std::vector<std::pair<Label, edge_id>>> tree_adjacency;
+
+    // entries[id] -> indexes in tree_adjacency[edge.from] and tree_adjacency[edge.to] of the
+    // tree edge identified by id
+    std::vector<std::array<std::size_t, 2>> entries;
+
+    // sum of the weights of the edges in tree
+    Weight weight = 0;
+
+    /**
+     * Scratch data of the replacement search. visited[v] == epoch iff v has been reached from
+     * the first end node of the cut edge, visited[v] == epoch + 1 iff v has been reached from
+     * the other one. Every search adds 2 to epoch instead of clearing visited.
+     */
+    std::vector<std::uint32_t> visited;
+    std::uint32_t epoch = 0;
+
+    // vertexes reached by the 2 sides of the replacement search, in BFS order
+    std::vector<Label> sides[2];
+
+    // return the weight of the edge (u, v), which must be in the graph
+    [[nodiscard]] Weight weight_of(const Label& u, const Label& v) const {
+        return graph.adjacent_vertexes(u).at(v);
+    }
+
+    // add edge, whose end nodes must be in different trees, to the forest
+    void link(const Edge<Label, Weight>& edge) {
+        const auto& [u, v, w] = edge;
+        const auto id = forest.link(edge);
+        if (positions.size() <= id) {
+            positions.resize(id + 1);
+            entries.resize(id + 1);
+        }
+
+        positions[id] = tree.size();
+        tree.push_back(edge);
+        tree_ids.emplace(edge, id);
+        weight += w;
+
+        entries[id] = {tree_adjacency[u].size(), tree_adjacency[v].size()};
+        tree_adjacency[u].emplace_back(v, id);
+        tree_adjacency[v].emplace_back(u, id);
+    }
+
+    // remove the k-th entry of tree_adjacency[x] in O(1) time. The last entry takes its place
+    void remove_entry(const Label& x, const std::size_t k) {
+        auto& adjacency = tree_adjacency[x];
+        if (k + 1 < adjacency.size()) {
+            adjacency[k] = adjacency.back();
+            const auto moved = adjacency[k].second;
+            entries[moved][forest.edge_at(moved).from == x ? 0 : 1] = k;
+        }
+        adjacency.pop_back();
+    }
+
+    // remove the tree edge identified by id from the forest. The last edge of tree takes its
+    // place
+    void cut(const edge_id id) {
+        const auto i = positions[id];
+        weight -= tree[i].weight;
+        tree_ids.erase(tree[i]);
+        remove_entry(tree[i].from, entries[id][0]);
+        remove_entry(tree[i].to, entries[id][1]);
+        forest.cut(id);
+
+        if (i + 1 < tree.size()) {
+            tree[i] = tree.back();
+            positions[tree_ids.at(tree[i])] = i;
+        }
+        tree.pop_back();
+    }
+
+    // the weight of edge, which must be in the graph, didn't increase: add edge to the forest if
+    // it isn't in a cycle, or if it's lighter than the heaviest edge of its cycle
+    void relax(const Edge<Label, Weight>& edge) {
+        const auto& [u, v, w] = edge;
+
+        if (!forest.connected(u, v)) {
+            link(edge);
+            return;
+        }
+
+        const auto heaviest = forest.path_max(u, v);
+        if (w < forest.edge_at(heaviest).weight) {
+            cut(heaviest);
+            link(edge);
+        }
+    }
+
+    // start a new replacement search: the marks of the previous searches are forgotten in O(1)
+    // amortized time
+    void new_search() {
+        if (epoch > std::numeric_limits<std::uint32_t>::max() - 4) {
+            std::fill(visited.begin(), visited.end(), 0);
+            epoch = 0;
+        }
+        epoch += 2;
+
+        sides[0].clear();
+        sides[1].clear();
+    }
+
+    // u and v have just been disconnected by cutting a tree edge: link the lightest edge of the
+    // graph that connects their trees again, if there is any.
+    // Time: O(s + d + logn), where s is the number of vertexes of the smaller tree and d is the
+    //       sum of their degrees in the graph
+    void reconnect(const Label& u, const Label& v) {
+        new_search();
+
+        // heads[side] -> index in sides[side] of the vertex being scanned, next[side] -> index
+        // of its next tree adjacency entry
+        const Label sources[2] = {u, v};
+        std::size_t heads[2] = {0, 0};
+        std::size_t next[2] = {0, 0};
+        for (int side = 0; side < 2; ++side) {
+            visited[sources[side]] = epoch + side;
+            sides[side].push_back(sources[side]);
+        }
+
+        // visit the trees of u and v alternately on the forest edges, one tree adjacency entry at
+        // a time. The side whose queue is exhausted first has visited its whole tree, and it's
+        // the smaller one
+        int side = 0;
+        while (heads[side] < sides[side].size()) {
+            const auto& adjacency = tree_adjacency[sides[side][heads[side]]];
+
+            if (next[side] < adjacency.size()) {
+                const auto y = adjacency[next[side]++].first;
+                if (visited[y] != epoch + side) {
+                    visited[y] = epoch + side;
+                    sides[side].push_back(y);
+                }
+            } else {
+                ++heads[side];
+                next[side] = 0;
+            }
+
+            side = 1 - side;
+        }
+
+        // the edges that leave the complete side are exactly the ones that cross the cut
+        const auto mark = epoch + side;
+        bool found = false;
+        Edge<Label, Weight> lightest;
+        for (const auto x : sides[side]) {
+            for (const auto& [y, w] : graph.adjacent_vertexes(x)) {
+                if (visited[y] != mark && (!found || w < lightest.weight)) {
+                    lightest = Edge<Label, Weight>(x, y, w);
+                    found = true;
+                }
+            }
+        }
+
+        if (found) {
+            link(lightest);
+        }
+    }
+
+public:
+    using const_iterator = typename std::vector<Edge<Label, Weight>>::const_iterator;
+
+    DynamicMST() = delete;
+
+    // create the Minimum Spanning Forest of n_vertexes vertexes without any edge
+    explicit DynamicMST(const std::size_t n_vertexes) :
+        graph({}, n_vertexes),
+        forest(n_vertexes),
+        tree_adjacency(n_vertexes),
+        visited(n_vertexes, 0) {
+        tree.reserve(n_vertexes > 0 ? n_vertexes - 1 : 0);
+        tree_ids.reserve(n_vertexes);
+    }
+
+    ~DynamicMST() = default;
+
+    /**
+     * Insert an edge in the graph, and update the Minimum Spanning Forest. Like
+     * AdjacencyMapGraph::add_edge, if the graph already has an edge between the same vertexes,
+     * it keeps the lower of the 2 weights.
+     * Time: O(logn) amortized
+     */
+    void insert(const Edge<Label, Weight>& edge) {
+        const auto& [u, v, w] = edge;
+
+        // a self loop is never part of a spanning forest
+        if (u == v) {
+            return;
+        }
+
+        if (graph.has_edge(u, v)) {
+            if (w < weight_of(u, v)) {
+                update_weight(edge);
+            }
+            return;
+        }
+
+        graph.add_edge(edge);
+        relax(edge);
+    }
+
+    /**
+     * Remove the edge between edge.from and edge.to, regardless of edge.weight, from the graph,
+     * and update the Minimum Spanning Forest. The edge must be in the graph.
+     * Time: O(logn) amortized if it isn't a tree edge, O(s + d + logn) otherwise (see
+     *       DynamicMST)
+     */
+    void erase(const Edge<Label, Weight>& edge) {
+        const auto& [u, v, _] = edge;
+        assert(graph.has_edge(u, v));
+
+        graph.remove_edge(edge);
+
+        const auto it = tree_ids.find(edge);
+        if (it != tree_ids.end()) {
+            cut(it->second);
+            reconnect(u, v);
+        }
+    }
+
+    /**
+     * Set the weight of the edge between edge.from and edge.to, which must be in the graph, to
+     * edge.weight, and update the Minimum Spanning Forest.
+     * Time: O(logn) amortized, except when a tree edge becomes heavier, which takes
+     *       O(s + d + logn) (see DynamicMST)
+     */
+    void update_weight(const Edge<Label, Weight>& edge) {
+        const auto& [u, v, w] = edge;
+        const auto old_weight = weight_of(u, v);
+        if (w == old_weight) {
+            return;
+        }
+
+        graph.remove_edge(edge);
+        graph.add_edge(edge);
+
+        const auto it = tree_ids.find(edge);
+        if (it == tree_ids.end()) {
+            // a non-tree edge that becomes heavier is still out of the forest
+            if (w < old_weight) {
+                relax(edge);
+            }
+            return;
+        }
+
+        cut(it->second);
+        if (w < old_weight) {
+            // a tree edge that becomes lighter is still in the forest
+            link(edge);
+        } else {
+            // edge crosses the cut, so it's a candidate replacement of itself
+            reconnect(u, v);
+        }
+    }
+
+    // return the number of vertexes of the graph.
+    // Time: O(1).
+    [[nodiscard]] std::size_t vertexes_size() const noexcept {
+        return forest.vertexes_size();
+    }
+
+    // return the number of edges of the Minimum Spanning Forest, which is n - 1 iff the graph
+    // is connected.
+    // Time: O(1).
+    [[nodiscard]] std::size_t size() const noexcept {
+        return tree.size();
+    }
+
+    // return the total weight of the Minimum Spanning Forest, the same value that sum_weights
+    // computes from cbegin() and cend().
+    // Time: O(1).
+    [[nodiscard]] Weight total_weight() const noexcept {
+        return weight;
+    }
+
+    // return the current graph.
+    // Time: O(1).
+    [[nodiscard]] const AdjacencyMapGraph<Label, Weight>& get_graph() const noexcept {
+        return graph;
+    }
+
+    // iterators over the edges of the Minimum Spanning Forest, in no particular order.
+    // They are invalidated by every update.
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return tree.cbegin();
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return tree.cend();
+    }
+};
+
+#endif  // DYNAMIC_MST_H
@@ -0,0 +1,66 @@
+#ifndef EDGE_H
+#define EDGE_H
+
+#include <cstddef>  // std::size_t
+
+/**
+ * Edge represents a weighted edge between two vertexes.
+ */
+template <typename Label, typename Weight>
+struct Edge {
+    Label from;
+    Label to;
+    Weight weight;
+
+    /**
+     * Default constructor used to represent "null" values when the MST is initialized
+     * in Prim's algorithm.
+     */
+    Edge() noexcept = default;
+
+    explicit Edge(const Label& from, const Label& to, const Weight& weight) noexcept :
+        from(from), to(to), weight(weight) {
+    }
+
+    /**
+     * Default assignment operator, needed to sort a container of Edges in place
+     */
+    Edge<Label, Weight>& operator=(const Edge<Label, Weight>& rhs) noexcept = default;
+
+    /**
+     * Default copy and move constructors, needed because in Prim's algorithm we need
+     * to override edges
+     */
+    Edge(const Edge<Label, Weight>& rhs) noexcept = default;
+    Edge(Edge<Label, Weight>&& rhs) noexcept = default;
+
+    /**
+     * Equality operator, used by std::unordered_set.
+     * (from, to, w1) and (to, from, w2) are considered the same edge, even if
+     * the weights are different.
+     */
+    bool operator==(const Edge& e) const noexcept {
+        return (from == e.from && to == e.to) || (to == e.from && from == e.to);
+    }
+};
+
+/**
+ * Hash functors for custom types
+ */
+namespace custom_hash {
+    // commutative hash functor for Edge<Label, Weight>, which ignores the weight. The end nodes
+    // are ordered and mixed by a multiplicative hash, so that the edges of the same vertex don't
+    // collide, even if it's the vertex 0
+    struct edge_hash {
+        template <class Label, class Weight>
+        std::size_t operator()(const Edge<Label, Weight>& edge) const noexcept {
+            constexpr auto golden_ratio = static_cast<std::size_t>(0x9E3779B97F4A7C15ULL);
+            const auto& [i, j, _] = edge;
+            const auto low = static_cast<std::size_t>(i < j ? i : j);
+            const auto high = static_cast<std::size_t>(i < j ? j : i);
+            return (low * golden_ratio) ^ high;
+        }
+    };
+}  // namespace custom_hash
+
+#endif  // EDGE_H
@@ -0,0 +1,152 @@
+#ifndef FAST_SCANNER_H
+#define FAST_SCANNER_H
+
+#include <cstdio>       // std::FILE, std::fread
+#include <cstring>      // std::memmove
+#include <memory>       // std::unique_ptr
+#include <string>       // std::string
+#include <type_traits>  // std::enable_if, std::is_integral, std::make_unsigned
+#include <vector>       // std::vector
+
+#include "MappedFile.h"
+
+/**
+ * Hand-written integer scanner that replaces formatted std::cin extraction.
+ * The input is either memory-mapped (when reading from a file) or read in large blocks
+ * (when reading from a stream such as stdin), and integers are parsed straight out of the
+ * raw bytes without any locale or stream state handling.
+ * Every character that is neither a digit nor a minus sign is treated as a separator.
+ */
+class FastScanner {
+    // size of a block read from a stream
+    static constexpr std::size_t block_size = 1 << 20;
+
+    // maximum length of a token. A token is never split between two blocks: the window is
+    // refilled before parsing whenever fewer than max_token_size bytes are left in it.
+    static constexpr std::size_t max_token_size = 64;
+
+    // stream the blocks are read from, nullptr when the input is memory-mapped
+    std::FILE* file = nullptr;
+
+    // memory mapping of the input file, nullptr when the input is a stream
+    std::unique_ptr<MappedFile> mapping;
+
+    // block buffer, used only when the input is a stream
+    std::vector<char> buffer;
+
+    // [pos, end) is the portion of the input that has been loaded but not parsed yet
+    const char* pos = nullptr;
+    const char* end = nullptr;
+
+    // true iff there is no more input after end
+    bool exhausted = false;
+
+    [[nodiscard]] static bool is_digit(const char c) noexcept {
+        // a single unsigned comparison instead of two signed ones
+        return static_cast<unsigned char>(c - '0') < 10;
+    }
+
+    [[nodiscard]] static bool is_token(const char c) noexcept {
+        return is_digit(c) || c == '-';
+    }
+
+    // move the bytes that haven't been parsed yet to the front of the buffer and read the next
+    // block right after them
+    void refill() {
+        const std::size_t tail = static_cast<std::size_t>(end - pos);
+        std::memmove(buffer.data(), pos, tail);
+
+        const std::size_t requested = buffer.size() - tail;
+        const std::size_t read = std::fread(buffer.data() + tail, 1, requested, file);
+        exhausted = read < requested;
+
+        pos = buffer.data();
+        end = pos + tail + read;
+    }
+
+    // skip separators and make sure that the whole next token, if any, is in [pos, end).
+    // Return true iff there is a token to parse.
+    bool skip_separators() {
+        while (true) {
+            while (pos != end && !is_token(*pos)) {
+                ++pos;
+            }
+
+            if (pos != end || exhausted) {
+                break;
+            }
+
+            refill();
+        }
+
+        if (!exhausted && static_cast<std::size_t>(end - pos) < max_token_size) {
+            refill();
+        }
+
+        return pos != end;
+    }
+
+    // parse the digits starting at pos. The caller must have called skip_separators() first.
+    template <typename Unsigned>
+    [[nodiscard]] Unsigned parse_digits() noexcept {
+        Unsigned value = 0;
+        while (pos != end && is_digit(*pos)) {
+            value = value * 10 + static_cast<Unsigned>(*pos - '0');
+            ++pos;
+        }
+        return value;
+    }
+
+public:
+    /**
+     * Read the input from the given stream in blocks of block_size bytes.
+     * The stream is not closed by FastScanner.
+     */
+    explicit FastScanner(std::FILE* file) : file(file), buffer(block_size) {
+        pos = end = buffer.data();
+    }
+
+    /**
+     * Memory-map the file at the given path and parse it in place.
+     * Throws std::runtime_error if the file can't be opened.
+     */
+    explicit FastScanner(const std::string& path) :
+        mapping(std::make_unique<MappedFile>(path)), exhausted(true) {
+        pos = mapping->data();
+        end = pos + mapping->size();
+    }
+
+    FastScanner(const FastScanner&) = delete;
+    FastScanner& operator=(const FastScanner&) = delete;
+
+    /**
+     * Return true iff there is at least one more integer in the input.
+     */
+    [[nodiscard]] bool has_next() {
+        return skip_separators();
+    }
+
+    /**
+     * Parse the next integer in the input. If the input is over, 0 is returned.
+     * T must be an integral type. A leading minus sign is honoured only if T is signed.
+     */
+    template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+    [[nodiscard]] T next() {
+        using unsigned_t = typename std::make_unsigned<T>::type;
+
+        if (!skip_separators()) {
+            return T(0);
+        }
+
+        const bool negative = *pos == '-';
+        pos += negative;
+
+        const auto magnitude = parse_digits<unsigned_t>();
+
+        // two's complement negation in the unsigned domain, so that the minimum value of T
+        // doesn't overflow
+        return static_cast<T>(negative ? unsigned_t(0) - magnitude : magnitude);
+    }
+};
+
+#endif  // FAST_SCANNER_H
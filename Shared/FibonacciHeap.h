@@ -0,0 +1,411 @@
+#ifndef FIBONACCI_HEAP_H
+#define FIBONACCI_HEAP_H
+
+#include <cassert>        // std::assert
+#include <functional>     // std::greater, std::less, std::hash
+#include <limits>         // std::numeric_limits
+#include <type_traits>    // std::conditional
+#include <unordered_map>  // std::unordered_map
+#include <utility>        // std::pair, std::swap
+#include <vector>         // std::vector
+
+#include "PriorityQueue.h"
+
+namespace priority_queue {
+
+    /**
+     * Priority Queue based on a Fibonacci Heap. It exposes the same interface of PriorityQueue,
+     * but push() takes O(1) time and update_key() takes O(1) amortized time when it moves an
+     * element towards the root (e.g. a decrease-key in a Min Heap), instead of O(logN).
+     * Nodes are allocated from a pool stored in a std::vector, and they are linked to each other
+     * by their index in the pool. Slots of popped nodes are recycled by later insertions.
+     * This class shouldn't be invoked directly.
+     * Instead, the factories make_min_fibonacci_priority_queue and
+     * make_max_fibonacci_priority_queue should be used.
+     *
+     * Key: type of the keys used to order the Heap.
+     * T: type of the elements stored in the Heap.
+     * T_Hash: functor used to hash values of type T. Unused if T is an unsigned integral type.
+     * Compare: comparison functor applied to the keys.
+     *          std::greater<> -> Min Heap
+     *          std::less<>    -> Max Heap
+     */
+    template <typename Key, typename T, typename THash = std::hash<T>,
+              class Compare = std::greater<>>
+    class FibonacciHeap {
+        // null link
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        struct node_t {
+            Key key;
+            T element;
+
+            // parent, npos if the node is a root
+            std::size_t parent;
+
+            // any of the children
+            std::size_t child;
+
+            // siblings in the circular doubly linked list of children, or of roots
+            std::size_t left;
+            std::size_t right;
+
+            // number of children
+            std::size_t degree;
+
+            // true iff the node lost a child since it became the child of its parent
+            bool marked;
+        };
+
+        using index_map_type =
+            typename std::conditional<detail::is_dense_v<T>, detail::dense_index_map<T>,
+                                      std::unordered_map<T, std::size_t, THash>>::type;
+
+        // pool of nodes
+        std::vector<node_t> pool;
+
+        // slots of pool that can be reused
+        std::vector<std::size_t> free_slots;
+
+        // index_map[element] -> index in pool of the node of element
+        index_map_type index_map;
+
+        // index in pool of the top root, npos if the heap is empty
+        std::size_t top_slot = npos;
+
+        // number of elements in the heap
+        std::size_t n_elements = 0;
+
+        // comparison functor
+        Compare comp;
+
+        // degree_table[d] -> root of degree d, used by consolidate()
+        std::vector<std::size_t> degree_table;
+
+        // nodes visited while walking a circular list, kept to avoid reallocations
+        std::vector<std::size_t> scratch;
+
+        // return the initial capacity of index_map
+        [[nodiscard]] static std::size_t map_capacity(const std::vector<T>& node_list) noexcept {
+            if constexpr (detail::is_dense_v<T>) {
+                return detail::dense_capacity(node_list);
+            } else {
+                return node_list.size();
+            }
+        }
+
+        // return the index in pool of a new node without links
+        std::size_t allocate(const Key& key, const T& element) {
+            const node_t node{key, element, npos, npos, npos, npos, 0, false};
+
+            if (free_slots.empty()) {
+                pool.push_back(node);
+                return pool.size() - 1;
+            }
+
+            const auto slot = free_slots.back();
+            free_slots.pop_back();
+            pool[slot] = node;
+            return slot;
+        }
+
+        // copy in scratch the nodes of the circular list that contains first
+        void collect_list(const std::size_t first) {
+            scratch.clear();
+            auto x = first;
+            do {
+                scratch.push_back(x);
+                x = pool[x].right;
+            } while (x != first);
+        }
+
+        // remove x from its circular list
+        void unlink(const std::size_t x) noexcept {
+            pool[pool[x].left].right = pool[x].right;
+            pool[pool[x].right].left = pool[x].left;
+            pool[x].left = pool[x].right = x;
+        }
+
+        // insert x, which must not belong to any list, next to y in the circular list of y
+        void splice(const std::size_t x, const std::size_t y) noexcept {
+            const auto next = pool[y].right;
+            pool[x].left = y;
+            pool[x].right = next;
+            pool[next].left = x;
+            pool[y].right = x;
+        }
+
+        // add x, which must not belong to any list, to the root list
+        void add_root(const std::size_t x) noexcept {
+            pool[x].parent = npos;
+            pool[x].marked = false;
+
+            if (top_slot == npos) {
+                pool[x].left = pool[x].right = x;
+                top_slot = x;
+                return;
+            }
+
+            splice(x, top_slot);
+            if (comp(pool[top_slot].key, pool[x].key)) {
+                top_slot = x;
+            }
+        }
+
+        // make the root y a child of the root x
+        void add_child(const std::size_t y, const std::size_t x) noexcept {
+            pool[y].parent = x;
+            pool[y].marked = false;
+
+            if (pool[x].child == npos) {
+                pool[y].left = pool[y].right = y;
+                pool[x].child = y;
+            } else {
+                splice(y, pool[x].child);
+            }
+
+            ++pool[x].degree;
+        }
+
+        // move x from the children of p to the root list
+        void cut(const std::size_t x, const std::size_t p) noexcept {
+            if (pool[x].right == x) {
+                pool[p].child = npos;
+            } else {
+                if (pool[p].child == x) {
+                    pool[p].child = pool[x].right;
+                }
+                unlink(x);
+            }
+
+            --pool[p].degree;
+            add_root(x);
+        }
+
+        // cut the ancestors of y as long as they have already lost a child
+        void cascading_cut(std::size_t y) noexcept {
+            for (auto p = pool[y].parent; p != npos; p = pool[y].parent) {
+                if (!pool[y].marked) {
+                    pool[y].marked = true;
+                    return;
+                }
+
+                cut(y, p);
+                y = p;
+            }
+        }
+
+        // move the children of x to the root list
+        void promote_children(const std::size_t x) {
+            if (pool[x].child == npos) {
+                return;
+            }
+
+            collect_list(pool[x].child);
+            pool[x].child = npos;
+            pool[x].degree = 0;
+
+            for (const auto c : scratch) {
+                add_root(c);
+            }
+        }
+
+        // link the roots with the same degree until every root has a distinct degree,
+        // and find the new top root.
+        // Time: O(logN) amortized
+        void consolidate() {
+            collect_list(top_slot);
+            degree_table.assign(degree_table.size(), npos);
+
+            for (auto x : scratch) {
+                pool[x].left = pool[x].right = x;
+                auto d = pool[x].degree;
+
+                while (d < degree_table.size() && degree_table[d] != npos) {
+                    auto y = degree_table[d];
+                    degree_table[d] = npos;
+
+                    // x must be the root of the resulting tree
+                    if (comp(pool[x].key, pool[y].key)) {
+                        std::swap(x, y);
+                    }
+
+                    add_child(y, x);
+                    ++d;
+                }
+
+                if (d >= degree_table.size()) {
+                    degree_table.resize(d + 1, npos);
+                }
+                degree_table[d] = x;
+            }
+
+            // rebuild the root list
+            top_slot = npos;
+            for (const auto x : degree_table) {
+                if (x != npos) {
+                    add_root(x);
+                }
+            }
+        }
+
+        // find the top root scanning the root list
+        // Time: O(number of roots)
+        void find_top() noexcept {
+            const auto first = top_slot;
+            for (auto x = pool[first].right; x != first; x = pool[x].right) {
+                if (comp(pool[top_slot].key, pool[x].key)) {
+                    top_slot = x;
+                }
+            }
+        }
+
+    public:
+        FibonacciHeap() = delete;
+
+        explicit FibonacciHeap(const std::vector<Key>& keys, const std::vector<T>& inputs) :
+            index_map(map_capacity(inputs)) {
+            assert(keys.size() == inputs.size());
+
+            // pushing a node into a Fibonacci Heap takes O(1) time
+            pool.reserve(inputs.size());
+            for (std::size_t i = 0; i < inputs.size(); ++i) {
+                push(keys[i], inputs[i]);
+            }
+        }
+
+        ~FibonacciHeap() = default;
+
+        // return the number of elements in the heap.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] std::size_t size() const noexcept {
+            return n_elements;
+        }
+
+        // return true iff the heap is empty.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        // add a new element to the heap and associates the given key to it.
+        // Time: O(1) amortized.
+        // Space: O(1) amortized.
+        void push(const Key& key, const T& element) {
+            const auto slot = allocate(key, element);
+            index_map[element] = slot;
+            add_root(slot);
+            ++n_elements;
+        }
+
+        // update the key of an element in the priority queue.
+        // The element must exist in the priority queue.
+        // Time: O(1) amortized if the element moves towards the root, O(logN) amortized instead.
+        // Space: O(1) amortized.
+        void update_key(const Key& key, const T& element) {
+            const std::size_t x = index_map.at(element);
+            const auto p = pool[x].parent;
+
+            // true iff the new key moves the element towards the root, e.g. a decreased key
+            // in a Min Heap or an increased key in a Max Heap
+            const bool towards_root = comp(pool[x].key, key);
+            pool[x].key = key;
+
+            if (towards_root) {
+                if (p != npos && comp(pool[p].key, key)) {
+                    cut(x, p);
+                    cascading_cut(p);
+                } else if (p == npos && comp(pool[top_slot].key, key)) {
+                    top_slot = x;
+                }
+                return;
+            }
+
+            // the children of x may now violate the heap property: they become roots, and x
+            // becomes a root without children
+            const bool was_top = x == top_slot;
+            promote_children(x);
+            if (p != npos) {
+                cut(x, p);
+                cascading_cut(p);
+            }
+
+            if (was_top) {
+                find_top();
+            }
+        }
+
+        // return the value of the key of the given element.
+        // Time: O(1) amortized, O(1) if T is an unsigned integral type.
+        // Space: O(1).
+        [[nodiscard]] const Key& key_at(const T& element) const {
+            return pool[index_map.at(element)].key;
+        }
+
+        // return true iff the given element is in the priority queue.
+        // Time: O(1) amortized, O(1) if T is an unsigned integral type.
+        // Space: O(1).
+        [[nodiscard]] bool contains(const T& element) const noexcept {
+            return index_map.count(element) > 0;
+        }
+
+        // return the top element.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] const T& top() const {
+            assert(!empty());
+            return pool[top_slot].element;
+        }
+
+        // return top key-value pair.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] std::pair<const Key&, const T&> top_key_value() const {
+            assert(!empty());
+            return {pool[top_slot].key, pool[top_slot].element};
+        }
+
+        // remove the top element.
+        // Time: O(logN) amortized.
+        // Space: O(1) amortized.
+        void pop() {
+            assert(!empty());
+
+            const auto z = top_slot;
+            index_map.erase(pool[z].element);
+            free_slots.push_back(z);
+            --n_elements;
+
+            promote_children(z);
+
+            if (pool[z].right == z) {
+                // z was the only root
+                top_slot = npos;
+                return;
+            }
+
+            top_slot = pool[z].right;
+            unlink(z);
+            consolidate();
+        }
+    };
+
+    // create a Priority Queue based on a Min Fibonacci Heap.
+    template <typename Key, typename Value, typename THash = std::hash<Value>>
+    auto make_min_fibonacci_priority_queue(const std::vector<Key>& keys = {},
+                                           const std::vector<Value>& inputs = {}) {
+        return FibonacciHeap<Key, Value, THash, std::greater<>>(keys, inputs);
+    }
+
+    // create a Priority Queue based on a Max Fibonacci Heap.
+    template <typename Key, typename Value, typename THash = std::hash<Value>>
+    auto make_max_fibonacci_priority_queue(const std::vector<Key>& keys = {},
+                                           const std::vector<Value>& inputs = {}) {
+        return FibonacciHeap<Key, Value, THash, std::less<>>(keys, inputs);
+    }
+
+}  // namespace priority_queue
+
+#endif  // FIBONACCI_HEAP_H
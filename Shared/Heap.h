@@ -1,56 +1,77 @@
 #ifndef HEAP_H
 #define HEAP_H
 
-#include <algorithm>   // std::swap
-#include <cassert>     // std::assert
-#include <functional>  // std::function
-#include <vector>      // std::vector
+#include <algorithm>    // std::swap
+#include <cassert>      // std::assert
+#include <type_traits>  // std::conditional, std::is_void
+#include <vector>       // std::vector
 
 namespace heap {
 
+    namespace detail {
+        // Derived if it isn't void, Self otherwise. It lets a heap class be used both on its own
+        // and as the CRTP base of a class that customizes some of its operations.
+        template <class Derived, class Self>
+        using derived_or_self_t =
+            typename std::conditional<std::is_void<Derived>::value, Self, Derived>::type;
+
+        // tag used by subclasses to construct a heap without building it, because the data
+        // needed to compare its nodes isn't available yet.
+        struct deferred_init_t {};
+        constexpr deferred_init_t deferred_init{};
+    }  // namespace detail
+
     /**
-     * Generic Heap abstract class. The elements are allocated in a std::vector<T> container.
+     * Generic Heap base class. The elements are allocated in a std::vector<T> container.
+     * Heap uses static polymorphism (CRTP) instead of virtual methods: every operation is
+     * resolved at compile time, and the comparator is a template parameter that can be
+     * inlined, instead of being called through a std::function.
      *
+     * Derived: the concrete heap class. It must implement parent(i), heapify_down(i) and
+     *          build_heap(), and it may shadow compare(a, b) and swap_nodes(i, j).
      * T: the type of the objects stored in the heap.
+     * Compare: comparison functor.
+     *          std::greater<> -> Min Heap
+     *          std::less<>    -> Max Heap
      * IsAlreadyHeap: constexpr bool flag. If true, build_heap() won't be called
      *                after the child class is constructed.
      *                If false, the given vector is considered an already valid heap.
      */
-    template <typename T, bool IsAlreadyHeap = false>
+    template <class Derived, typename T, class Compare, bool IsAlreadyHeap = false>
     class Heap {
     protected:
-        // comparison function alias type
-        using compare_t = std::function<bool(T, T)>;
-
         // keep the values in the heap
         std::vector<T> nodes;
 
         // comparison functor
-        // std::greater<> -> Min Heap
-        // std::less<>    -> Max Heap
-        compare_t comp;
+        Compare comp;
 
-        // protected constructor to let the subclass set the comparator after the initialization
-        explicit Heap(const std::vector<T>& inputs) noexcept : nodes(inputs) {
+        explicit Heap(const std::vector<T>& inputs, const Compare& comp) :
+            nodes(inputs), comp(comp) {
         }
 
-        // protected constructor to let the subclass set the comparator after the initialization
-        explicit Heap(std::vector<T>&& inputs) noexcept : nodes(inputs) {
+        explicit Heap(std::vector<T>&& inputs, const Compare& comp) noexcept :
+            nodes(std::move(inputs)), comp(comp) {
         }
 
-        // return the parent of nodes[i]
-        [[nodiscard]] virtual std::size_t parent(std::size_t i) const noexcept = 0;
+        ~Heap() = default;
 
-        // transform the internal vector in a heap in O(n)
-        virtual void build_heap() noexcept = 0;
+        [[nodiscard]] Derived& derived() noexcept {
+            return static_cast<Derived&>(*this);
+        }
 
-        // starting from a Heap with a misplaced node at the given index,
-        // recover the shape and heap properties bubbling the node down.
-        virtual void heapify_down(std::size_t index_to_fix) noexcept = 0;
+        [[nodiscard]] const Derived& derived() const noexcept {
+            return static_cast<const Derived&>(*this);
+        }
+
+        // return true iff a must be placed below b in the heap
+        [[nodiscard]] bool compare(const T& a, const T& b) const noexcept {
+            return comp(a, b);
+        }
 
         // swap 2 nodes in the heap
-        virtual void swap_nodes(std::size_t i, std::size_t j) noexcept {
-            std::swap(nodes.at(i), nodes.at(j));
+        void swap_nodes(const std::size_t i, const std::size_t j) noexcept {
+            std::swap(nodes[i], nodes[j]);
         }
 
         // starting from a Heap with a misplaced node at the given index,
@@ -58,9 +79,13 @@ namespace heap {
         void heapify_up(const std::size_t index_to_fix) noexcept {
             std::size_t i = index_to_fix;
 
-            while (i > 0 && comp(nodes.at(parent(i)), nodes.at(i))) {
-                const auto p = parent(i);
-                swap_nodes(i, p);
+            while (i > 0) {
+                const auto p = derived().parent(i);
+                if (!derived().compare(nodes[p], nodes[i])) {
+                    return;
+                }
+
+                derived().swap_nodes(i, p);
                 i = p;
             }
         }
@@ -69,7 +94,7 @@ namespace heap {
         // valid heap from the beginning
         void init() noexcept {
             if constexpr (!IsAlreadyHeap) {
-                build_heap();
+                derived().build_heap();
             }
         }
 
@@ -77,17 +102,6 @@ namespace heap {
         // disable public default constructor
         Heap() = delete;
 
-        explicit Heap(const std::vector<T>& inputs, compare_t&& comp) noexcept :
-            nodes(inputs), comp(comp) {
-        }
-
-        explicit Heap(std::vector<T>&& inputs, compare_t&& comp) noexcept :
-            nodes(inputs), comp(comp) {
-        }
-
-        // virtual destructor because this is a base class
-        virtual ~Heap() = default;
-
         // return the number of elements in the heap
         [[nodiscard]] size_t size() const noexcept {
             return nodes.size();
@@ -102,7 +116,7 @@ namespace heap {
         [[nodiscard]] const T& top() const {
             assert(size() > 0);
 
-            return nodes.at(0);
+            return nodes[0];
         }
 
         // remove the top element of the heap (which must exist)
@@ -110,13 +124,13 @@ namespace heap {
             assert(size() > 0);
 
             // replace root of the heap with the last element of the vector
-            nodes.at(0) = nodes.back();
+            nodes[0] = std::move(nodes.back());
 
             // remove the last element of the vector
             nodes.pop_back();
 
             // the root violates the heap property, so it must be fixed
-            heapify_down(0);
+            derived().heapify_down(0);
         }
 
         // add a new element to the heap
@@ -0,0 +1,158 @@
+#ifndef INCREMENTAL_MST_H
+#define INCREMENTAL_MST_H
+
+#include <vector>  // std::vector
+
+#include "Edge.h"
+#include "LinkCutTree.h"
+
+/**
+ * Minimum Spanning Forest of a graph over the vertexes [0, n) that grows by edge insertions,
+ * so it never has to be recomputed from scratch.
+ * An inserted edge that links 2 different trees is added to the forest. Otherwise it closes a
+ * cycle, and it replaces the heaviest edge on that cycle if it is lighter than it (cycle
+ * property). The forest is kept in a link-cut tree, so every insertion takes O(logn) amortized
+ * time, and a batch of k edges takes O(klogn) regardless of the number of edges inserted so far.
+ * An existing MST, e.g. the one returned by kruskal_mst_compressed, can be loaded by inserting
+ * its edges.
+ *
+ * Label: type of the vertexes, which must be an unsigned integer type.
+ * Weight: type of the weights of the edges.
+ */
+template <typename Label, typename Weight>
+class IncrementalMST {
+    using edge_id = typename dynamic_tree::LinkCutTree<Label, Weight>::edge_id;
+
+    // current forest
+    dynamic_tree::LinkCutTree<Label, Weight> forest;
+
+    // edges of the current forest, in no particular order
+    std::vector<Edge<Label, Weight>> tree;
+
+    // tree_ids[i] -> identifier in forest of tree[i]
+    std::vector<edge_id> tree_ids;
+
+    // positions[id] -> index in tree of the edge identified by id in forest
+    std::vector<std::size_t> positions;
+
+    // sum of the weights of the edges in tree
+    Weight weight = 0;
+
+    // add edge, whose end nodes must be in different trees, to the forest
+    void add(const Edge<Label, Weight>& edge) {
+        const auto id = forest.link(edge);
+        if (positions.size() <= id) {
+            positions.resize(id + 1);
+        }
+
+        positions[id] = tree.size();
+        tree.push_back(edge);
+        tree_ids.push_back(id);
+        weight += edge.weight;
+    }
+
+    // remove the edge identified by id from the forest. The last edge of tree takes its place
+    void remove(const edge_id id) {
+        const auto i = positions[id];
+        weight -= tree[i].weight;
+        forest.cut(id);
+
+        tree[i] = tree.back();
+        tree_ids[i] = tree_ids.back();
+        positions[tree_ids[i]] = i;
+        tree.pop_back();
+        tree_ids.pop_back();
+    }
+
+public:
+    using const_iterator = typename std::vector<Edge<Label, Weight>>::const_iterator;
+
+    IncrementalMST() = delete;
+
+    // create the Minimum Spanning Forest of n_vertexes vertexes without any edge
+    explicit IncrementalMST(const std::size_t n_vertexes) : forest(n_vertexes) {
+        tree.reserve(n_vertexes > 0 ? n_vertexes - 1 : 0);
+        tree_ids.reserve(n_vertexes > 0 ? n_vertexes - 1 : 0);
+    }
+
+    ~IncrementalMST() = default;
+
+    /**
+     * Insert an edge in the graph, and update the Minimum Spanning Forest.
+     * Return true iff edge has been added to the forest, possibly in place of a heavier edge.
+     * Time:  O(logn) amortized
+     * Space: O(1) amortized
+     */
+    bool insert(const Edge<Label, Weight>& edge) {
+        const auto& [u, v, w] = edge;
+
+        // a self loop is never part of a spanning forest
+        if (u == v) {
+            return false;
+        }
+
+        if (!forest.connected(u, v)) {
+            add(edge);
+            return true;
+        }
+
+        // edge closes a cycle: it's in the MST iff it's lighter than the heaviest edge of the
+        // cycle, which is the heaviest edge on the tree path between u and v
+        const auto heaviest = forest.path_max(u, v);
+        if (!(w < forest.edge_at(heaviest).weight)) {
+            return false;
+        }
+
+        remove(heaviest);
+        add(edge);
+        return true;
+    }
+
+    /**
+     * Insert the batch of edges [first, last) in the graph, and update the Minimum Spanning
+     * Forest.
+     * Return the number of edges of the batch that have been added to the forest.
+     * Time:  O(klogn) amortized, where k is the size of the batch
+     * Space: O(1) amortized
+     */
+    template <class It>
+    std::size_t insert(It first, const It last) {
+        std::size_t n_added = 0;
+        for (; first != last; ++first) {
+            n_added += insert(*first) ? 1 : 0;
+        }
+        return n_added;
+    }
+
+    // return the number of vertexes of the graph.
+    // Time: O(1).
+    [[nodiscard]] std::size_t vertexes_size() const noexcept {
+        return forest.vertexes_size();
+    }
+
+    // return the number of edges of the Minimum Spanning Forest, which is n - 1 iff the graph
+    // is connected.
+    // Time: O(1).
+    [[nodiscard]] std::size_t size() const noexcept {
+        return tree.size();
+    }
+
+    // return the total weight of the Minimum Spanning Forest, the same value that sum_weights
+    // computes from cbegin() and cend().
+    // Time: O(1).
+    [[nodiscard]] Weight total_weight() const noexcept {
+        return weight;
+    }
+
+    // iterators over the edges of the Minimum Spanning Forest, in no particular order.
+    // They are invalidated by insert().
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return tree.cbegin();
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return tree.cend();
+    }
+};
+
+#endif  // INCREMENTAL_MST_H
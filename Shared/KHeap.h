@@ -1,6 +1,7 @@
 #ifndef K_HEAP_H
 #define K_HEAP_H
 
+#include <functional>   // std::greater, std::less
 #include <type_traits>  // std::enable_if
 #include <vector>       // std::vector
 
@@ -19,11 +20,32 @@ namespace heap {
      * IsAlreadyHeap: constexpr bool flag. If true, build_heap() won't be called
      *                the class is constructed.
      *                If false, the given vector is considered an already valid heap.
+     * Compare: comparison functor, std::greater<> for a Min Heap, std::less<> for a Max Heap.
+     * Derived: void, or the class that derives KHeap to customize compare(a, b) and
+     *          swap_nodes(i, j), like PriorityQueue does.
      */
     template <std::size_t K, typename T, bool IsAlreadyHeap = false,
+              class Compare = std::greater<>, class Derived = void,
               typename = typename std::enable_if<(K > 2)>::type>
-    class KHeap : public Heap<T, IsAlreadyHeap> {
-        using super = Heap<T, IsAlreadyHeap>;
+    class KHeap;
+
+    namespace detail {
+        // CRTP base class of KHeap
+        template <std::size_t K, typename T, bool IsAlreadyHeap, class Compare, class Derived>
+        using k_heap_base =
+            Heap<derived_or_self_t<Derived, KHeap<K, T, IsAlreadyHeap, Compare, Derived>>, T,
+                 Compare, IsAlreadyHeap>;
+    }  // namespace detail
+
+    template <std::size_t K, typename T, bool IsAlreadyHeap, class Compare, class Derived,
+              typename>
+    class KHeap : public detail::k_heap_base<K, T, IsAlreadyHeap, Compare, Derived> {
+    protected:
+        using heap_base = detail::k_heap_base<K, T, IsAlreadyHeap, Compare, Derived>;
+
+    private:
+        using super = heap_base;
+        friend heap_base;
 
         // returns the j-th child of the i-th node.
         [[nodiscard]] static size_t child(const size_t i, const size_t j) noexcept {
@@ -36,26 +58,29 @@ namespace heap {
         }
 
     protected:
-        using compare_t = typename super::compare_t;
-
-        // protected constructor to let the subclass set the comparator after the initialization
-        explicit KHeap(const std::vector<T>& inputs) noexcept : super(inputs) {
+        // protected constructor to let the subclass initialize the data used by its comparator
+        // before the heap is built
+        explicit KHeap(const std::vector<T>& inputs, detail::deferred_init_t) :
+            super(inputs, Compare()) {
         }
 
-        // protected constructor to let the subclass set the comparator after the initialization
-        explicit KHeap(std::vector<T>&& inputs) noexcept : super(std::move(inputs)) {
+        // protected constructor to let the subclass initialize the data used by its comparator
+        // before the heap is built
+        explicit KHeap(std::vector<T>&& inputs, detail::deferred_init_t) noexcept :
+            super(std::move(inputs), Compare()) {
         }
 
         // return the parent of nodes[i]
-        [[nodiscard]] std::size_t parent(const std::size_t i) const noexcept final override {
+        [[nodiscard]] static std::size_t parent(const std::size_t i) noexcept {
             return (i - 1) / K;
         }
 
         // starting from a Heap with a misplaced node at the given index,
         // recover the shape and heap properties bubbling the node down.
-        void heapify_down(const std::size_t index_to_fix) noexcept override {
+        void heapify_down(const std::size_t index_to_fix) noexcept {
             const std::size_t len = this->size();
             std::size_t i = index_to_fix;
+            auto& self = this->derived();
 
             // comp_est is the biggest element in a Max Heap,
             // or the smallest element in a Min Heap
@@ -65,7 +90,7 @@ namespace heap {
                 // Time: O(K)
                 for (std::size_t j = 0; j < K; ++j) {
                     const auto son = child(i, j);
-                    if (son < len && this->comp(this->nodes.at(comp_est), this->nodes.at(son))) {
+                    if (son < len && self.compare(this->nodes[comp_est], this->nodes[son])) {
                         comp_est = son;
                     }
                 }
@@ -74,57 +99,61 @@ namespace heap {
                     return;
                 }
 
-                this->swap_nodes(i, comp_est);
+                self.swap_nodes(i, comp_est);
                 i = comp_est;
             }
         }
 
         // transform the internal vector in a heap in O(n)
-        void build_heap() noexcept override final {
+        void build_heap() noexcept {
             for (std::size_t i = (this->size() / K) + 1; i > 0; --i) {
                 heapify_down(i - 1);
             }
         }
 
     public:
+        // the same heap, with another comparator and another derived class
+        template <class OtherCompare, class OtherDerived>
+        using rebind = KHeap<K, T, IsAlreadyHeap, OtherCompare, OtherDerived>;
+
         // disable public default constructor
         KHeap() = delete;
 
-        explicit KHeap(const std::vector<T>& inputs, compare_t&& comp) noexcept :
-            super(inputs, std::move(comp)) {
+        explicit KHeap(const std::vector<T>& inputs, const Compare& comp = Compare()) :
+            super(inputs, comp) {
             this->init();
         }
 
-        explicit KHeap(std::vector<T>&& inputs, compare_t&& comp) noexcept :
-            super(std::move(inputs), std::move(comp)) {
+        explicit KHeap(std::vector<T>&& inputs, const Compare& comp = Compare()) noexcept :
+            super(std::move(inputs), comp) {
             this->init();
         }
 
-        virtual ~KHeap() = default;
+        ~KHeap() = default;
     };
 
     // create a Min K-Heap copying the input vector
     template <std::size_t K, bool IsAlreadyHeap = false, typename T>
     auto make_min_k_heap(const std::vector<T>& inputs) {
-        return KHeap<K, T, IsAlreadyHeap>(inputs, std::greater<>{});
+        return KHeap<K, T, IsAlreadyHeap, std::greater<>>(inputs);
     }
 
     // create a Min K-Heap moving the input vector
     template <std::size_t K, bool IsAlreadyHeap = false, typename T>
     auto make_min_k_heap(std::vector<T>&& inputs = {}) {
-        return KHeap<K, T, IsAlreadyHeap>(std::move(inputs), std::greater<>{});
+        return KHeap<K, T, IsAlreadyHeap, std::greater<>>(std::move(inputs));
     }
 
     // create a Max K-Heap copying the input vector
     template <std::size_t K, bool IsAlreadyHeap = false, typename T>
     auto make_max_k_heap(const std::vector<T>& inputs) {
-        return KHeap<K, T, IsAlreadyHeap>(inputs, std::less<>{});
+        return KHeap<K, T, IsAlreadyHeap, std::less<>>(inputs);
     }
 
     // create a Max K-Heap moving the input vector
     template <std::size_t K, bool IsAlreadyHeap = false, typename T>
     auto make_max_k_heap(std::vector<T>&& inputs = {}) {
-        return KHeap<K, T, IsAlreadyHeap>(std::move(inputs), std::less<>{});
+        return KHeap<K, T, IsAlreadyHeap, std::less<>>(std::move(inputs));
     }
 
 }  // namespace heap
@@ -0,0 +1,322 @@
+#ifndef LINK_CUT_TREE_H
+#define LINK_CUT_TREE_H
+
+#include <cassert>  // std::assert
+#include <limits>   // std::numeric_limits
+#include <utility>  // std::swap
+#include <vector>   // std::vector
+
+#include "Edge.h"
+
+namespace dynamic_tree {
+
+    /**
+     * Link-cut tree (Sleator and Tarjan) that maintains a forest of weighted trees over the
+     * vertexes [0, n) under edge insertions and deletions. It answers whether 2 vertexes are
+     * connected, and which is the heaviest edge on the tree path between them.
+     * Every edge is represented by a node of its own between the nodes of its endpoints, so the
+     * heaviest edge of a path is the heaviest node of the path. The preferred paths are stored
+     * in splay trees, whose nodes are allocated from a pool stored in a std::vector and linked to
+     * each other by their index in the pool. Slots of cut edges are recycled by later links.
+     * Every operation takes O(logn) amortized time.
+     *
+     * Label: type of the vertexes, which must be an unsigned integer type.
+     * Weight: type of the weights of the edges.
+     */
+    template <typename Label, typename Weight>
+    class LinkCutTree {
+    public:
+        // identifier of an edge of the forest, returned by link()
+        using edge_id = std::size_t;
+
+    private:
+        // null link
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        struct node_t {
+            // left and right children in the splay tree
+            std::size_t child[2];
+
+            // parent in the splay tree, or path-parent if the node is the root of a splay tree
+            std::size_t parent;
+
+            // heaviest edge node in the splay tree rooted in this node, npos if there isn't any
+            std::size_t max_slot;
+
+            // true iff the children of every node in the subtree must be swapped
+            bool flipped;
+        };
+
+        // number of vertexes. pool[v] is the node of vertex v, the following nodes are edges
+        const std::size_t n_vertexes;
+
+        // pool of nodes
+        std::vector<node_t> pool;
+
+        // edges[slot - n_vertexes] -> edge represented by the node pool[slot]
+        std::vector<Edge<Label, Weight>> edges;
+
+        // slots of pool of cut edges that can be reused
+        std::vector<std::size_t> free_slots;
+
+        // ancestors of the node being splayed, kept to avoid reallocations
+        std::vector<std::size_t> scratch;
+
+        [[nodiscard]] bool is_edge(const std::size_t x) const noexcept {
+            return x >= n_vertexes;
+        }
+
+        [[nodiscard]] const Weight& weight_of(const std::size_t slot) const noexcept {
+            return edges[slot - n_vertexes].weight;
+        }
+
+        // return the heaviest of 2 edge nodes, either of which may be npos
+        [[nodiscard]] std::size_t heavier(const std::size_t a, const std::size_t b) const noexcept {
+            if (a == npos) {
+                return b;
+            }
+            if (b == npos) {
+                return a;
+            }
+            return weight_of(a) < weight_of(b) ? b : a;
+        }
+
+        // return true iff x is the root of its splay tree
+        [[nodiscard]] bool is_splay_root(const std::size_t x) const noexcept {
+            const auto p = pool[x].parent;
+            return p == npos || (pool[p].child[0] != x && pool[p].child[1] != x);
+        }
+
+        // recompute max_slot of x from its children
+        void update(const std::size_t x) noexcept {
+            auto& node = pool[x];
+            auto max_slot = is_edge(x) ? x : npos;
+            for (const auto c : node.child) {
+                if (c != npos) {
+                    max_slot = heavier(max_slot, pool[c].max_slot);
+                }
+            }
+            node.max_slot = max_slot;
+        }
+
+        // swap the children of x, and propagate the pending flip to them
+        void push(const std::size_t x) noexcept {
+            auto& node = pool[x];
+            if (!node.flipped) {
+                return;
+            }
+
+            std::swap(node.child[0], node.child[1]);
+            for (const auto c : node.child) {
+                if (c != npos) {
+                    pool[c].flipped = !pool[c].flipped;
+                }
+            }
+            node.flipped = false;
+        }
+
+        // rotate x over its parent, which must be in the same splay tree
+        void rotate(const std::size_t x) noexcept {
+            const auto p = pool[x].parent;
+            const auto g = pool[p].parent;
+            const int side = pool[p].child[1] == x ? 1 : 0;
+
+            // x takes the place of p in g, which may be a path-parent
+            if (!is_splay_root(p)) {
+                pool[g].child[pool[g].child[1] == p ? 1 : 0] = x;
+            }
+            pool[x].parent = g;
+
+            // the inner child of x becomes a child of p
+            const auto inner = pool[x].child[1 - side];
+            pool[p].child[side] = inner;
+            if (inner != npos) {
+                pool[inner].parent = p;
+            }
+
+            pool[x].child[1 - side] = p;
+            pool[p].parent = x;
+
+            update(p);
+            update(x);
+        }
+
+        // make x the root of its splay tree
+        void splay(const std::size_t x) {
+            // push the pending flips from the root of the splay tree down to x
+            scratch.clear();
+            for (auto y = x;; y = pool[y].parent) {
+                scratch.push_back(y);
+                if (is_splay_root(y)) {
+                    break;
+                }
+            }
+            for (auto it = scratch.crbegin(); it != scratch.crend(); ++it) {
+                push(*it);
+            }
+
+            while (!is_splay_root(x)) {
+                const auto p = pool[x].parent;
+                if (!is_splay_root(p)) {
+                    // zig-zig rotates the parent first, zig-zag rotates x twice
+                    const auto g = pool[p].parent;
+                    const bool zig_zig = (pool[g].child[0] == p) == (pool[p].child[0] == x);
+                    rotate(zig_zig ? p : x);
+                }
+                rotate(x);
+            }
+        }
+
+        // make the path from the root of the tree of x to x preferred, and splay x at the root
+        // of its splay tree, which then contains exactly that path
+        void access(const std::size_t x) {
+            std::size_t last = npos;
+            for (auto y = x; y != npos; y = pool[y].parent) {
+                splay(y);
+                pool[y].child[1] = last;
+                update(y);
+                last = y;
+            }
+            splay(x);
+        }
+
+        // make x the root of its tree
+        void make_root(const std::size_t x) {
+            access(x);
+            pool[x].flipped = !pool[x].flipped;
+        }
+
+        // return the root of the tree of x
+        [[nodiscard]] std::size_t find_root(std::size_t x) {
+            access(x);
+            while (true) {
+                push(x);
+                if (pool[x].child[0] == npos) {
+                    break;
+                }
+                x = pool[x].child[0];
+            }
+            splay(x);
+            return x;
+        }
+
+        // add the tree edge (x, y). x and y must be in different trees
+        void link_nodes(const std::size_t x, const std::size_t y) {
+            make_root(x);
+            pool[x].parent = y;
+        }
+
+        // remove the tree edge (x, y)
+        void cut_nodes(const std::size_t x, const std::size_t y) {
+            make_root(x);
+            access(y);
+
+            // the path from x to y is made by x and y only, so x is the left child of y
+            assert(pool[y].child[0] == x && pool[x].child[1] == npos);
+            pool[y].child[0] = npos;
+            pool[x].parent = npos;
+            update(y);
+        }
+
+        // return the index in pool of a new edge node without links
+        std::size_t allocate(const Edge<Label, Weight>& edge) {
+            const node_t node{{npos, npos}, npos, npos, false};
+
+            if (free_slots.empty()) {
+                pool.push_back(node);
+                edges.push_back(edge);
+                return pool.size() - 1;
+            }
+
+            const auto slot = free_slots.back();
+            free_slots.pop_back();
+            pool[slot] = node;
+            edges[slot - n_vertexes] = edge;
+            return slot;
+        }
+
+    public:
+        LinkCutTree() = delete;
+
+        // create a forest of n_vertexes vertexes without edges
+        explicit LinkCutTree(const std::size_t n_vertexes) :
+            n_vertexes(n_vertexes), pool(n_vertexes, node_t{{npos, npos}, npos, npos, false}) {
+            // a spanning forest has less than n_vertexes edges
+            pool.reserve(n_vertexes > 0 ? 2 * n_vertexes - 1 : 0);
+            edges.reserve(n_vertexes > 0 ? n_vertexes - 1 : 0);
+        }
+
+        ~LinkCutTree() = default;
+
+        // return the number of vertexes of the forest.
+        // Time: O(1).
+        [[nodiscard]] std::size_t vertexes_size() const noexcept {
+            return n_vertexes;
+        }
+
+        // return the number of edges of the forest.
+        // Time: O(1).
+        [[nodiscard]] std::size_t edges_size() const noexcept {
+            return pool.size() - n_vertexes - free_slots.size();
+        }
+
+        // return the edge identified by id, which must be in the forest.
+        // Time: O(1).
+        [[nodiscard]] const Edge<Label, Weight>& edge_at(const edge_id id) const noexcept {
+            assert(is_edge(id));
+            return edges[id - n_vertexes];
+        }
+
+        // return true iff there is a path between u and v in the forest, i.e. iff adding the
+        // edge (u, v) would close a cycle.
+        // Time: O(logn) amortized.
+        [[nodiscard]] bool connected(const Label& u, const Label& v) {
+            if (u == v) {
+                return true;
+            }
+
+            make_root(u);
+            return find_root(v) == u;
+        }
+
+        // add the given edge to the forest, and return its identifier. Its endpoints must not
+        // be connected, which the caller checks with connected(): it isn't asserted here because
+        // connected() restructures the splay trees, so debug builds would run different code.
+        // Time: O(logn) amortized.
+        edge_id link(const Edge<Label, Weight>& edge) {
+            const auto slot = allocate(edge);
+            pool[slot].max_slot = slot;
+
+            link_nodes(edge.from, slot);
+            link_nodes(slot, edge.to);
+            return slot;
+        }
+
+        // remove the edge identified by id from the forest. The identifier may be returned
+        // again by a later link().
+        // Time: O(logn) amortized.
+        void cut(const edge_id id) {
+            assert(is_edge(id));
+            const auto& edge = edges[id - n_vertexes];
+
+            cut_nodes(edge.from, id);
+            cut_nodes(id, edge.to);
+            free_slots.push_back(id);
+        }
+
+        // return the identifier of the heaviest edge on the path between u and v, which must be
+        // connected and different from each other. Ties are broken arbitrarily.
+        // Time: O(logn) amortized.
+        [[nodiscard]] edge_id path_max(const Label& u, const Label& v) {
+            assert(u != v);
+
+            make_root(u);
+            access(v);
+            assert(pool[v].max_slot != npos);
+            return pool[v].max_slot;
+        }
+    };
+
+}  // namespace dynamic_tree
+
+#endif  // LINK_CUT_TREE_H
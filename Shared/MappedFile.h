@@ -0,0 +1,152 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>    // std::size_t
+#include <stdexcept>  // std::runtime_error
+#include <string>     // std::string
+#include <utility>    // std::exchange
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap, madvise
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close
+#endif
+
+/**
+ * Read-only memory mapping of a whole file. The mapping is released when the object is
+ * destroyed, so every pointer obtained via data() must not outlive the MappedFile object.
+ * Throws std::runtime_error if the file can't be opened or mapped.
+ */
+class MappedFile {
+    const char* mapped_data = nullptr;
+    std::size_t mapped_size = 0;
+
+#ifdef _WIN32
+    HANDLE file_handle = INVALID_HANDLE_VALUE;
+    HANDLE mapping_handle = nullptr;
+#endif
+
+    [[noreturn]] static void fail(const std::string& path, const char* what) {
+        throw std::runtime_error("MappedFile: " + std::string(what) + " '" + path + "'");
+    }
+
+    void release() noexcept {
+#ifdef _WIN32
+        if (mapped_data) {
+            UnmapViewOfFile(mapped_data);
+        }
+        if (mapping_handle) {
+            CloseHandle(mapping_handle);
+        }
+        if (file_handle != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_handle);
+        }
+        mapping_handle = nullptr;
+        file_handle = INVALID_HANDLE_VALUE;
+#else
+        if (mapped_data) {
+            munmap(const_cast<char*>(mapped_data), mapped_size);
+        }
+#endif
+        mapped_data = nullptr;
+        mapped_size = 0;
+    }
+
+public:
+    explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+        file_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_handle == INVALID_HANDLE_VALUE) {
+            fail(path, "cannot open");
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file_handle, &file_size)) {
+            release();
+            fail(path, "cannot stat");
+        }
+        mapped_size = static_cast<std::size_t>(file_size.QuadPart);
+
+        // an empty file can't be mapped, but it is still a valid (empty) input
+        if (mapped_size > 0) {
+            mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mapping_handle) {
+                release();
+                fail(path, "cannot map");
+            }
+
+            mapped_data =
+                static_cast<const char*>(MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
+            if (!mapped_data) {
+                release();
+                fail(path, "cannot map");
+            }
+        }
+#else
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            fail(path, "cannot open");
+        }
+
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0) {
+            close(fd);
+            fail(path, "cannot stat");
+        }
+        const auto size = static_cast<std::size_t>(file_stat.st_size);
+
+        // an empty file can't be mapped, but it is still a valid (empty) input
+        if (size > 0) {
+            void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                close(fd);
+                fail(path, "cannot map");
+            }
+
+            // the file is parsed front to back, let the kernel read ahead aggressively
+            madvise(data, size, MADV_SEQUENTIAL);
+
+            mapped_data = static_cast<const char*>(data);
+            mapped_size = size;
+        }
+
+        // the mapping stays valid after the file descriptor is closed
+        close(fd);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& rhs) noexcept :
+        mapped_data(std::exchange(rhs.mapped_data, nullptr)),
+        mapped_size(std::exchange(rhs.mapped_size, 0)) {
+#ifdef _WIN32
+        file_handle = std::exchange(rhs.file_handle, INVALID_HANDLE_VALUE);
+        mapping_handle = std::exchange(rhs.mapping_handle, nullptr);
+#endif
+    }
+
+    ~MappedFile() {
+        release();
+    }
+
+    // return a pointer to the first byte of the file
+    [[nodiscard]] const char* data() const noexcept {
+        return mapped_data;
+    }
+
+    // return the size of the file in bytes
+    [[nodiscard]] std::size_t size() const noexcept {
+        return mapped_size;
+    }
+};
+
+#endif  // MAPPED_FILE_H
@@ -0,0 +1,315 @@
+#ifndef PAIRING_HEAP_H
+#define PAIRING_HEAP_H
+
+#include <cassert>        // std::assert
+#include <functional>     // std::greater, std::less, std::hash
+#include <limits>         // std::numeric_limits
+#include <type_traits>    // std::conditional
+#include <unordered_map>  // std::unordered_map
+#include <utility>        // std::pair, std::swap
+#include <vector>         // std::vector
+
+#include "PriorityQueue.h"
+
+namespace priority_queue {
+
+    /**
+     * Priority Queue based on a Pairing Heap. It exposes the same interface of PriorityQueue,
+     * but update_key() takes O(1) amortized time when it moves an element towards the root
+     * (e.g. a decrease-key in a Min Heap), instead of O(logN).
+     * Nodes are allocated from a pool stored in a std::vector, and they are linked to each other
+     * by their index in the pool. Slots of popped nodes are recycled by later insertions.
+     * This class shouldn't be invoked directly.
+     * Instead, the factories make_min_pairing_priority_queue and make_max_pairing_priority_queue
+     * should be used.
+     *
+     * Key: type of the keys used to order the Heap.
+     * T: type of the elements stored in the Heap.
+     * T_Hash: functor used to hash values of type T. Unused if T is an unsigned integral type.
+     * Compare: comparison functor applied to the keys.
+     *          std::greater<> -> Min Heap
+     *          std::less<>    -> Max Heap
+     */
+    template <typename Key, typename T, typename THash = std::hash<T>,
+              class Compare = std::greater<>>
+    class PairingHeap {
+        // null link
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        struct node_t {
+            Key key;
+            T element;
+
+            // leftmost child
+            std::size_t child;
+
+            // right sibling
+            std::size_t sibling;
+
+            // left sibling, or parent if the node is the leftmost child
+            std::size_t prev;
+        };
+
+        using index_map_type =
+            typename std::conditional<detail::is_dense_v<T>, detail::dense_index_map<T>,
+                                      std::unordered_map<T, std::size_t, THash>>::type;
+
+        // pool of nodes
+        std::vector<node_t> pool;
+
+        // slots of pool that can be reused
+        std::vector<std::size_t> free_slots;
+
+        // index_map[element] -> index in pool of the node of element
+        index_map_type index_map;
+
+        // index in pool of the root, npos if the heap is empty
+        std::size_t root = npos;
+
+        // number of elements in the heap
+        std::size_t n_elements = 0;
+
+        // comparison functor
+        Compare comp;
+
+        // roots melded by the first pass of merge_pairs(), kept to avoid reallocations
+        std::vector<std::size_t> pairs;
+
+        // return the initial capacity of index_map
+        [[nodiscard]] static std::size_t map_capacity(const std::vector<T>& node_list) noexcept {
+            if constexpr (detail::is_dense_v<T>) {
+                return detail::dense_capacity(node_list);
+            } else {
+                return node_list.size();
+            }
+        }
+
+        // return the index in pool of a new node without links
+        std::size_t allocate(const Key& key, const T& element) {
+            if (free_slots.empty()) {
+                pool.push_back({key, element, npos, npos, npos});
+                return pool.size() - 1;
+            }
+
+            const auto slot = free_slots.back();
+            free_slots.pop_back();
+            pool[slot] = {key, element, npos, npos, npos};
+            return slot;
+        }
+
+        // unlink the node x from its parent and siblings. x must not be a root
+        void cut(const std::size_t x) noexcept {
+            auto& node = pool[x];
+
+            if (pool[node.prev].child == x) {
+                pool[node.prev].child = node.sibling;
+            } else {
+                pool[node.prev].sibling = node.sibling;
+            }
+
+            if (node.sibling != npos) {
+                pool[node.sibling].prev = node.prev;
+            }
+
+            node.prev = npos;
+            node.sibling = npos;
+        }
+
+        // link the trees rooted in a and b, and return the root of the resulting tree.
+        // a and b must be roots without siblings.
+        // Time:  O(1)
+        [[nodiscard]] std::size_t meld(std::size_t a, std::size_t b) noexcept {
+            if (a == npos) {
+                return b;
+            }
+            if (b == npos) {
+                return a;
+            }
+
+            // a must be the root of the resulting tree
+            if (comp(pool[a].key, pool[b].key)) {
+                std::swap(a, b);
+            }
+
+            // b becomes the leftmost child of a
+            const auto first_child = pool[a].child;
+            pool[b].sibling = first_child;
+            pool[b].prev = a;
+            if (first_child != npos) {
+                pool[first_child].prev = b;
+            }
+            pool[a].child = b;
+
+            return a;
+        }
+
+        // meld the list of siblings starting from first with the standard two-pass strategy,
+        // and return the root of the resulting tree.
+        // Time:  O(logN) amortized
+        [[nodiscard]] std::size_t merge_pairs(std::size_t first) {
+            if (first == npos) {
+                return npos;
+            }
+
+            // first pass: meld the siblings in pairs, from left to right
+            pairs.clear();
+            while (first != npos) {
+                const auto a = first;
+                const auto b = pool[a].sibling;
+                first = b == npos ? npos : pool[b].sibling;
+
+                pool[a].prev = pool[a].sibling = npos;
+                if (b != npos) {
+                    pool[b].prev = pool[b].sibling = npos;
+                }
+
+                pairs.push_back(meld(a, b));
+            }
+
+            // second pass: meld the resulting trees, from right to left
+            auto result = pairs.back();
+            for (std::size_t i = pairs.size() - 1; i > 0; --i) {
+                result = meld(pairs[i - 1], result);
+            }
+
+            return result;
+        }
+
+    public:
+        PairingHeap() = delete;
+
+        explicit PairingHeap(const std::vector<Key>& keys, const std::vector<T>& inputs) :
+            index_map(map_capacity(inputs)) {
+            assert(keys.size() == inputs.size());
+
+            // pushing a node into a Pairing Heap takes O(1) time
+            pool.reserve(inputs.size());
+            for (std::size_t i = 0; i < inputs.size(); ++i) {
+                push(keys[i], inputs[i]);
+            }
+        }
+
+        ~PairingHeap() = default;
+
+        // return the number of elements in the heap.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] std::size_t size() const noexcept {
+            return n_elements;
+        }
+
+        // return true iff the heap is empty.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        // add a new element to the heap and associates the given key to it.
+        // Time: O(1) amortized.
+        // Space: O(1) amortized.
+        void push(const Key& key, const T& element) {
+            const auto slot = allocate(key, element);
+            index_map[element] = slot;
+            root = meld(root, slot);
+            ++n_elements;
+        }
+
+        // update the key of an element in the priority queue.
+        // The element must exist in the priority queue.
+        // Time: O(1) amortized if the element moves towards the root, O(logN) amortized instead.
+        // Space: O(1) amortized.
+        void update_key(const Key& key, const T& element) {
+            const std::size_t x = index_map.at(element);
+
+            // true iff the new key moves the element towards the root, e.g. a decreased key
+            // in a Min Heap or an increased key in a Max Heap
+            const bool towards_root = comp(pool[x].key, key);
+            pool[x].key = key;
+
+            if (towards_root) {
+                // the subtree rooted in x is still a valid heap, only its link with the parent
+                // may be broken
+                if (x != root) {
+                    cut(x);
+                    root = meld(root, x);
+                }
+            } else {
+                // the children of x may now violate the heap property: x is detached from
+                // them and melded again as a single node
+                const auto children = pool[x].child;
+                pool[x].child = npos;
+
+                if (x == root) {
+                    root = npos;
+                } else {
+                    cut(x);
+                }
+
+                root = meld(root, merge_pairs(children));
+                root = meld(root, x);
+            }
+        }
+
+        // return the value of the key of the given element.
+        // Time: O(1) amortized, O(1) if T is an unsigned integral type.
+        // Space: O(1).
+        [[nodiscard]] const Key& key_at(const T& element) const {
+            return pool[index_map.at(element)].key;
+        }
+
+        // return true iff the given element is in the priority queue.
+        // Time: O(1) amortized, O(1) if T is an unsigned integral type.
+        // Space: O(1).
+        [[nodiscard]] bool contains(const T& element) const noexcept {
+            return index_map.count(element) > 0;
+        }
+
+        // return the top element.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] const T& top() const {
+            assert(!empty());
+            return pool[root].element;
+        }
+
+        // return top key-value pair.
+        // Time: O(1).
+        // Space: O(1).
+        [[nodiscard]] std::pair<const Key&, const T&> top_key_value() const {
+            assert(!empty());
+            return {pool[root].key, pool[root].element};
+        }
+
+        // remove the top element.
+        // Time: O(logN) amortized.
+        // Space: O(1) amortized.
+        void pop() {
+            assert(!empty());
+
+            const auto old_root = root;
+            index_map.erase(pool[old_root].element);
+            free_slots.push_back(old_root);
+            --n_elements;
+
+            root = merge_pairs(pool[old_root].child);
+        }
+    };
+
+    // create a Priority Queue based on a Min Pairing Heap.
+    template <typename Key, typename Value, typename THash = std::hash<Value>>
+    auto make_min_pairing_priority_queue(const std::vector<Key>& keys = {},
+                                         const std::vector<Value>& inputs = {}) {
+        return PairingHeap<Key, Value, THash, std::greater<>>(keys, inputs);
+    }
+
+    // create a Priority Queue based on a Max Pairing Heap.
+    template <typename Key, typename Value, typename THash = std::hash<Value>>
+    auto make_max_pairing_priority_queue(const std::vector<Key>& keys = {},
+                                         const std::vector<Value>& inputs = {}) {
+        return PairingHeap<Key, Value, THash, std::less<>>(keys, inputs);
+    }
+
+}  // namespace priority_queue
+
+#endif  // PAIRING_HEAP_H
@@ -1,11 +1,13 @@
 #ifndef PRIORITY_QUEUE_H
 #define PRIORITY_QUEUE_H
 
-#include <algorithm>      // std::swap, std::find
+#include <algorithm>      // std::swap, std::find, std::max_element
 #include <cassert>        // std::assert
-#include <functional>     // std::function
-#include <type_traits>    // std::enable_if
+#include <functional>     // std::greater, std::less, std::hash
+#include <limits>         // std::numeric_limits
+#include <type_traits>    // std::conditional, std::is_integral, std::is_unsigned
 #include <unordered_map>  // std::unordered_map
+#include <vector>         // std::vector
 
 #include "BinaryHeap.h"
 #include "Heap.h"
@@ -13,37 +15,142 @@
 
 namespace priority_queue {
 
-    // utility enum class used in PriorityQueue.update_key() to understand at compile time
-    // whether PriorityQueue is using a Min Heap or a Max Heap implementation.
-    enum class Type { min_heap, max_heap };
+    namespace detail {
+        // true iff the elements of type T can be used directly as indexes of a std::vector.
+        // In that case PriorityQueue keeps keys and positions in flat vectors instead of hash
+        // tables. Elements are expected to be dense, i.e. in [0, N) where N is the number of
+        // elements, as the vectors are sized after the biggest element.
+        template <typename T>
+        constexpr bool is_dense_v = std::is_integral<T>::value && std::is_unsigned<T>::value;
+
+        // return the size of a vector that can be indexed by every element of node_list
+        template <typename T>
+        [[nodiscard]] std::size_t dense_capacity(const std::vector<T>& node_list) noexcept {
+            if (node_list.empty()) {
+                return 0;
+            }
+            return static_cast<std::size_t>(
+                       *std::max_element(node_list.cbegin(), node_list.cend())) +
+                   1;
+        }
+
+        /**
+         * Replacement of std::unordered_map<T, Key> for dense unsigned elements.
+         * The key of element x is stored in keys[x]. Keys of erased elements are left behind,
+         * since PriorityQueue never reads the key of an element it doesn't contain.
+         */
+        template <typename T, typename Key>
+        class dense_key_map {
+            std::vector<Key> keys;
+
+        public:
+            explicit dense_key_map(const std::size_t capacity = 0) : keys(capacity) {
+            }
+
+            Key& operator[](const T& element) {
+                if (element >= keys.size()) {
+                    keys.resize(element + 1);
+                }
+                return keys[element];
+            }
+
+            [[nodiscard]] Key& at(const T& element) noexcept {
+                assert(element < keys.size());
+                return keys[element];
+            }
+
+            [[nodiscard]] const Key& at(const T& element) const noexcept {
+                assert(element < keys.size());
+                return keys[element];
+            }
+
+            void erase(const T&) noexcept {
+            }
+        };
+
+        /**
+         * Replacement of std::unordered_map<T, std::size_t> for dense unsigned elements.
+         * The position in the heap of element x is stored in indexes[x], and npos marks the
+         * elements that are not in the heap.
+         */
+        template <typename T>
+        class dense_index_map {
+            static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+            std::vector<std::size_t> indexes;
+
+        public:
+            explicit dense_index_map(const std::size_t capacity = 0) : indexes(capacity, npos) {
+            }
+
+            std::size_t& operator[](const T& element) {
+                if (element >= indexes.size()) {
+                    indexes.resize(element + 1, npos);
+                }
+                return indexes[element];
+            }
+
+            [[nodiscard]] std::size_t& at(const T& element) noexcept {
+                assert(count(element));
+                return indexes[element];
+            }
+
+            [[nodiscard]] const std::size_t& at(const T& element) const noexcept {
+                assert(count(element));
+                return indexes[element];
+            }
+
+            [[nodiscard]] std::size_t count(const T& element) const noexcept {
+                return element < indexes.size() && indexes[element] != npos;
+            }
+
+            void erase(const T& element) noexcept {
+                if (element < indexes.size()) {
+                    indexes[element] = npos;
+                }
+            }
+        };
+    }  // namespace detail
 
     /**
      * Generic Priority Queue based on a Heap. Whether it is based on a MinHeap or a MaxHeap
-     * depends on CompareFactory object used for initialization.
+     * depends on the Compare functor applied to the keys.
      * This class shouldn't be invoked directly.
      * Instead, the factories make_min_priority_queue, make_max_priority_queue,
      * make_min_k_priority_queue, make_max_k_priority_queue should be used.
      *
-     * Heap: type of the parent class of PriorityQueue. It must derive heap::Heap.
+     * Heap: heap::BinaryHeap or heap::KHeap. PriorityQueue derives the same heap rebound to
+     *       itself, so that the heap compares its nodes by key and keeps index_map updated
+     *       while moving them, without any virtual call.
      * Key: type of the keys used to order the Heap.
      * T: type of the elements stored in the Heap underlying the Priority Queue.
      * IsAlreadyHeap: constexpr flag. If true, build_heap() won't be called after the class is
      *                constructed. If false, the given input is considered an already valid heap
      *                according to its keys.
      * T_Hash: functor used to hash values of type T. Necessary only if T is a non-trivial type.
-     * HeapType: enum utility used to understand whether Heap is a Min Heap or a Max Heap.
+     *        Unused if T is an unsigned integral type: keys and positions are then stored in
+     *        flat vectors indexed by element, which spares a hash lookup on every operation.
+     * Compare: comparison functor applied to the keys.
+     *          std::greater<> -> Min Heap
+     *          std::less<>    -> Max Heap
      */
     template <class Heap, typename Key, typename T, bool IsAlreadyHeap = false,
-              typename THash = std::hash<T>, Type HeapType = Type::min_heap,
-              typename = std::enable_if<std::is_base_of<heap::Heap<T, IsAlreadyHeap>, Heap>::value>>
-    class PriorityQueue : Heap {
-        using super = Heap;
-
-        using key_map_type = std::unordered_map<T, Key, THash>;
-        using index_map_type = std::unordered_map<T, std::size_t, THash>;
-        using compare_t = std::function<bool(T, T)>;
-        using compare_factory_t = std::function<compare_t(key_map_type&)>;
-
+              typename THash = std::hash<T>, class Compare = std::greater<>>
+    class PriorityQueue
+        : Heap::template rebind<Compare,
+                                PriorityQueue<Heap, Key, T, IsAlreadyHeap, THash, Compare>> {
+        using super = typename Heap::template rebind<Compare, PriorityQueue>;
+
+        // the heap classes call compare() and swap_nodes() of PriorityQueue
+        friend super;
+        friend typename super::heap_base;
+
+        using key_map_type =
+            typename std::conditional<detail::is_dense_v<T>, detail::dense_key_map<T, Key>,
+                                      std::unordered_map<T, Key, THash>>::type;
+        using index_map_type =
+            typename std::conditional<detail::is_dense_v<T>, detail::dense_index_map<T>,
+                                      std::unordered_map<T, std::size_t, THash>>::type;
         // keep track of the value of the keys of each node.
         // key_map[element] -> key assigned to element
         key_map_type key_map;
@@ -52,13 +159,21 @@ namespace priority_queue {
         // index_map[element] -> index in this->nodes of element
         index_map_type index_map;
 
+        // return the initial capacity of key_map and index_map
+        [[nodiscard]] static std::size_t map_capacity(const std::vector<T>& node_list) noexcept {
+            if constexpr (detail::is_dense_v<T>) {
+                return detail::dense_capacity(node_list);
+            } else {
+                return node_list.size();
+            }
+        }
+
         // initialize key_map
-        template <typename UKey, typename U, typename UHash>
-        [[nodiscard]] static auto build_key_map(const std::vector<UKey>& keys,
-                                                const std::vector<U>& node_list) {
+        [[nodiscard]] static key_map_type build_key_map(const std::vector<Key>& keys,
+                                                        const std::vector<T>& node_list) {
             assert(keys.size() == node_list.size());
 
-            std::unordered_map<U, UKey, UHash> local_key_map(node_list.size());
+            key_map_type local_key_map(map_capacity(node_list));
 
             // traverses keys and node_list at the same time
             std::size_t index = 0;
@@ -71,9 +186,8 @@ namespace priority_queue {
         }
 
         // initialize index_map
-        template <typename U, typename UHash>
-        [[nodiscard]] static auto build_index_map(const std::vector<U>& node_list) {
-            std::unordered_map<U, std::size_t, UHash> local_index_map(node_list.size());
+        [[nodiscard]] static index_map_type build_index_map(const std::vector<T>& node_list) {
+            index_map_type local_index_map(map_capacity(node_list));
 
             std::size_t index = 0;
             for (const auto& node : node_list) {
@@ -84,20 +198,16 @@ namespace priority_queue {
             return local_index_map;
         }
 
-        // initialize class
-        void init(compare_factory_t&& comp_factory) {
-            // set comparator in base class after initialization of key_map and index_map.
-            // We can't set it directly in super(inputs, comp_factory(key_map) because we need
-            // to initialize key_map first, and member objects can only be initialized after
-            // the parent class is completely initialized.
-            this->comp = comp_factory(key_map);
-            super::init();
+    protected:
+        // compare two elements by their keys. It shadows heap::Heap::compare().
+        [[nodiscard]] bool compare(const T& a, const T& b) const noexcept {
+            return this->comp(key_map.at(a), key_map.at(b));
         }
 
-    protected:
+        // swap 2 nodes in the heap and their indexes. It shadows heap::Heap::swap_nodes().
         void swap_nodes(std::size_t i, std::size_t j) noexcept {
-            auto node_i = this->nodes.at(i);
-            auto node_j = this->nodes.at(j);
+            const auto& node_i = this->nodes[i];
+            const auto& node_j = this->nodes[j];
 
             // swap the indexes
             std::swap(index_map.at(node_i), index_map.at(node_j));
@@ -109,20 +219,21 @@ namespace priority_queue {
     public:
         PriorityQueue() = delete;
 
-        explicit PriorityQueue(const std::vector<Key>& keys, const std::vector<T>& inputs,
-                               compare_factory_t&& comp_factory) :
-            super(inputs),
-            key_map(build_key_map<Key, T, THash>(keys, this->nodes)),
-            index_map(build_index_map<T, THash>(this->nodes)) {
-            init(std::move(comp_factory));
+        // the heap can only be built after the initialization of key_map and index_map,
+        // because compare() reads key_map. Member objects are initialized after the parent
+        // class, so the construction of the heap is deferred to super::init().
+        explicit PriorityQueue(const std::vector<Key>& keys, const std::vector<T>& inputs) :
+            super(inputs, heap::detail::deferred_init),
+            key_map(build_key_map(keys, this->nodes)),
+            index_map(build_index_map(this->nodes)) {
+            super::init();
         }
 
-        explicit PriorityQueue(std::vector<Key>&& keys, std::vector<T>&& inputs,
-                               compare_factory_t&& comp_factory) :
-            super(std::move(inputs)),
-            key_map(build_key_map<Key, T, THash>(std::move(keys), this->nodes)),
-            index_map(build_index_map<T, THash>(this->nodes)) {
-            init(std::move(comp_factory));
+        explicit PriorityQueue(std::vector<Key>&& keys, std::vector<T>&& inputs) :
+            super(std::move(inputs), heap::detail::deferred_init),
+            key_map(build_key_map(keys, this->nodes)),
+            index_map(build_index_map(this->nodes)) {
+            super::init();
         }
 
         ~PriorityQueue() = default;
@@ -158,31 +269,33 @@ namespace priority_queue {
         // Space: O(1) amortized.
         void update_key(const Key& key, const T& element) {
             const std::size_t index_to_fix = index_map.at(element);
-            key_map.at(element) = key;
+            Key& element_key = key_map.at(element);
+
+            // true iff the new key moves the element towards the root, e.g. a decreased key
+            // in a Min Heap or an increased key in a Max Heap
+            const bool towards_root = this->comp(element_key, key);
+            element_key = key;
 
             // recover the heap property
-            if constexpr (HeapType == Type::min_heap) {
-                // we're using a MinHeap, thus we are decreasing the key
+            if (towards_root) {
                 this->heapify_up(index_to_fix);
             } else {
-                // we're using a MaxHeap, thus we are increasing the key
                 this->heapify_down(index_to_fix);
             }
         }
 
         // return the value of the key of the given element.
-        // Time: O(1) amortized.
+        // Time: O(1) amortized, O(1) if T is an unsigned integral type.
         // Space: O(1).
         [[nodiscard]] const Key& key_at(const T& element) const {
             return key_map.at(element);
         }
 
         // return true iff the given element is in the priority queue.
-        // Time: O(1) amortized.
+        // Time: O(1) amortized, O(1) if T is an unsigned integral type.
         // Space: O(1).
         [[nodiscard]] bool contains(const T& element) const noexcept {
-            const auto search = index_map.find(element);
-            return search != index_map.end();
+            return index_map.count(element) > 0;
         }
 
         // return the top element.
@@ -208,19 +321,19 @@ namespace priority_queue {
             assert(this->size() > 0);
 
             const std::size_t index_to_remove = 0;
-            const auto node = this->nodes.at(index_to_remove);
+            const auto node = this->nodes[index_to_remove];
             index_map.erase(node);
             key_map.erase(node);
 
             // replace root of the heap with the last element of the vector
-            this->nodes.at(0) = this->nodes.back();
+            this->nodes[0] = std::move(this->nodes.back());
 
             // remove the last element of the vector
             this->nodes.pop_back();
 
             // no need to recover the heap property if the heap is empty
             if (this->size() > 0) {
-                const auto front = this->nodes.front();
+                const auto& front = this->nodes.front();
                 index_map.at(front) = 0;
 
                 // the root violates the heap property. Let's fix that
@@ -229,27 +342,13 @@ namespace priority_queue {
         }
     };
 
-    namespace detail {
-        inline auto min_heap_comp_factory = [](auto& key_map) {
-            return [&key_map](auto&& a, auto&& b) -> bool {
-                return key_map.at(a) > key_map.at(b);
-            };
-        };
-
-        inline auto max_heap_comp_factory = [](auto& key_map) {
-            return [&key_map](auto&& a, auto&& b) -> bool {
-                return key_map.at(a) < key_map.at(b);
-            };
-        };
-    }  // namespace detail
-
     // create a Priority Queue based on a Min Heap. It copies the given vectors.
     template <bool IsAlreadyHeap = false, typename Key, typename Value,
               typename THash = std::hash<Value>>
     auto make_min_priority_queue(const std::vector<Key>& keys, const std::vector<Value>& inputs) {
         using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
-                                 THash, Type::min_heap>;
-        return pq(keys, inputs, detail::min_heap_comp_factory);
+                                 THash, std::greater<>>;
+        return pq(keys, inputs);
     }
 
     // create a Priority Queue based on a Min Heap. It moves the given vectors.
@@ -257,8 +356,8 @@ namespace priority_queue {
               typename THash = std::hash<Value>>
     auto make_min_priority_queue(std::vector<Key>&& keys = {}, std::vector<Value>&& inputs = {}) {
         using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
-                                 THash, Type::min_heap>;
-        return pq(std::move(keys), std::move(inputs), detail::min_heap_comp_factory);
+                                 THash, std::greater<>>;
+        return pq(std::move(keys), std::move(inputs));
     }
 
     // create a Priority Queue based on a Max Heap. It copies the given vectors.
@@ -266,8 +365,8 @@ namespace priority_queue {
               typename THash = std::hash<Value>>
     auto make_max_priority_queue(const std::vector<Key>& keys, const std::vector<Value>& inputs) {
         using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
-                                 THash, Type::max_heap>;
-        return pq(keys, inputs, detail::max_heap_comp_factory);
+                                 THash, std::less<>>;
+        return pq(keys, inputs);
     }
 
     // create a Priority Queue based on a Max Heap. It moves the given vectors.
@@ -275,8 +374,8 @@ namespace priority_queue {
               typename THash = std::hash<Value>>
     auto make_max_priority_queue(std::vector<Key>&& keys = {}, std::vector<Value>&& inputs = {}) {
         using pq = PriorityQueue<heap::BinaryHeap<Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
-                                 THash, Type::max_heap>;
-        return pq(std::move(keys), std::move(inputs), detail::max_heap_comp_factory);
+                                 THash, std::less<>>;
+        return pq(std::move(keys), std::move(inputs));
     }
 
     // create a Priority Queue based on a Min K-Heap. It copies the given vectors.
@@ -284,8 +383,8 @@ namespace priority_queue {
               typename THash = std::hash<Value>>
     auto make_min_k_priority_queue(const std::vector<Key>& keys, const std::vector<Value>& inputs) {
         using pq = PriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
-                                 THash, Type::min_heap>;
-        return pq(keys, inputs, detail::min_heap_comp_factory);
+                                 THash, std::greater<>>;
+        return pq(keys, inputs);
     }
 
     // create a Priority Queue based on a Min K-Heap. It moves the given vectors.
@@ -293,8 +392,8 @@ namespace priority_queue {
               typename THash = std::hash<Value>>
     auto make_min_k_priority_queue(std::vector<Key>&& keys = {}, std::vector<Value>&& inputs = {}) {
         using pq = PriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
-                                 THash, Type::min_heap>;
-        return pq(std::move(keys), std::move(inputs), detail::min_heap_comp_factory);
+                                 THash, std::greater<>>;
+        return pq(std::move(keys), std::move(inputs));
     }
 
     // create a Priority Queue based on a Max K-Heap. It copies the given vectors.
@@ -302,8 +401,8 @@ namespace priority_queue {
               typename THash = std::hash<Value>>
     auto make_max_k_priority_queue(const std::vector<Key>& keys, const std::vector<Value>& inputs) {
         using pq = PriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
-                                 THash, Type::max_heap>;
-        return pq(keys, inputs, detail::max_heap_comp_factory);
+                                 THash, std::less<>>;
+        return pq(keys, inputs);
     }
 
     // create a Priority Queue based on a Max K-Heap. It moves the given vectors.
@@ -311,8 +410,8 @@ namespace priority_queue {
               typename THash = std::hash<Value>>
     auto make_max_k_priority_queue(std::vector<Key>&& keys = {}, std::vector<Value>&& inputs = {}) {
         using pq = PriorityQueue<heap::KHeap<K, Value, IsAlreadyHeap>, Key, Value, IsAlreadyHeap,
-                                 THash, Type::max_heap>;
-        return pq(std::move(keys), std::move(inputs), detail::max_heap_comp_factory);
+                                 THash, std::less<>>;
+        return pq(std::move(keys), std::move(inputs));
     }
 
 }  // namespace priority_queue
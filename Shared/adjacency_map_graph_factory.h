@@ -1,11 +1,12 @@
 #ifndef ADJACENCY_MAP_GRAPH_FACTORY_H
 #define ADJACENCY_MAP_GRAPH_FACTORY_H
 
-#include <iostream>     // std::cin
 #include <type_traits>  // std::enable_if, std::is_unsigned, std::is_signed
-#include <vector>       // std::vector
 
 #include "AdjacencyMapGraph.h"
+#include "cli_options.h"
+#include "edge_list_factory.h"
+#include "edge_list_loader.h"
 
 /**
  * Helper that reads a graph from a text file.
@@ -24,29 +25,7 @@ template <typename Label, typename Weight,
           typename = typename std::enable_if<std::is_unsigned<Label>::value>::type,
           typename = typename std::enable_if<std::is_signed<Weight>::value>::type>
 AdjacencyMapGraph<Label, Weight> adjacency_map_graph_factory() {
-    size_t n;  // number of vertexes
-    size_t m;  // number of edges
-    std::cin >> n >> m;
-
-    // vector that stores the edges read from the input file
-    std::vector<Edge<Label, Weight>> edge_list;
-    edge_list.reserve(m);
-
-    Label u;
-    Label v;
-    Weight w;
-
-    size_t i = m;
-    while (i > 0) {
-        /**
-         * For each row of the input file, we read a weighted edge.
-         * The edge between u and v weights w.
-         * Time: O(m)
-         */
-        std::cin >> u >> v >> w;
-        edge_list.emplace_back(u - 1, v - 1, w);
-        i--;
-    }
+    auto [n, edge_list] = edge_list_factory<Label, Weight>();
 
     // after the creation of adj_map_graph, edge_list is no longer accessible
     AdjacencyMapGraph<Label, Weight> adj_map_graph(std::move(edge_list), n);
@@ -54,4 +33,15 @@ AdjacencyMapGraph<Label, Weight> adjacency_map_graph_factory() {
     return adj_map_graph;
 }
 
+/**
+ * Helper that reads a graph with the loader selected by the given command-line options.
+ * See load_graph.
+ */
+template <typename Label, typename Weight,
+          typename = typename std::enable_if<std::is_unsigned<Label>::value>::type,
+          typename = typename std::enable_if<std::is_signed<Weight>::value>::type>
+AdjacencyMapGraph<Label, Weight> adjacency_map_graph_factory(const CliOptions& options) {
+    return load_graph<AdjacencyMapGraph<Label, Weight>, Label, Weight>(options);
+}
+
 #endif  // ADJACENCY_MAP_GRAPH_FACTORY_H
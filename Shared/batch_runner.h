@@ -0,0 +1,172 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include <algorithm>   // std::min, std::sort
+#include <cstdio>      // stdin
+#include <exception>   // std::exception
+#include <filesystem>  // std::filesystem
+#include <iostream>    // std::cout, std::fixed
+#include <string>      // std::string
+#include <vector>      // std::vector
+
+#include "FastScanner.h"
+#include "cli_options.h"
+#include "edge_list_factory.h"
+#include "fast_edge_list_factory.h"
+#include "parallel_for.h"
+
+namespace detail {
+
+    // return the paths of the input_random_*.txt files in the given directory, sorted by name
+    inline std::vector<std::string> batch_input_files(const std::string& directory) {
+        constexpr const char prefix[] = "input_random_";
+        constexpr const char extension[] = ".txt";
+
+        std::vector<std::string> paths;
+        for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+            const auto name = entry.path().filename().string();
+            if (entry.is_regular_file() && name.rfind(prefix, 0) == 0 &&
+                entry.path().extension() == extension) {
+                paths.push_back(entry.path().string());
+            }
+        }
+
+        std::sort(paths.begin(), paths.end());
+        return paths;
+    }
+
+}  // namespace detail
+
+/**
+ * Compute the MST of many graphs in the same process, so that the process startup, the memory
+ * allocator warm-up and the stream setup are paid once for all of them (--batch).
+ * - If the input file is a directory, the graphs are its input_random_*.txt files, and a line
+ *   "<path> <total weight>" is printed for every file, in the order of their names.
+ * - Otherwise the input, stdin or the input file, is a stream of text graphs one after the
+ *   other, each in the usual format, and a line "<total weight>" is printed for every graph.
+ * The graphs are parsed with FastScanner into EdgeList buffers that are reused by the next
+ * graphs, and Graph is built from the edges of the buffer.
+ * The graphs are processed in rounds of options.n_threads graphs (0 means one for every hardware
+ * thread), one graph per thread, and every MST is computed by a single thread. The files of a
+ * directory are also parsed in parallel, while a stream is parsed by the calling thread.
+ * A graph that can't be read or solved reports "error: <what>" in place of its total weight.
+ * Exceptions never escape the worker threads, which would call std::terminate, but are recorded
+ * per graph and reported by the calling thread. The other graphs of a directory are still
+ * solved. In a stream, the graphs read before a malformed one are still solved and reported,
+ * but the batch stops after it, because the start of the next graph can't be found.
+ * Return true iff the MST of every graph has been computed.
+ *
+ * Graph must be constructible from an array of edges followed by the number of vertexes, like
+ * AdjacencyMapGraph and CSRGraph.
+ * mst_weight(Graph&&, n_threads) must return the total weight of the MST of the given graph.
+ * Throws std::runtime_error if the input stream can't be opened or read.
+ */
+template <class Graph, typename Label, typename Weight, class MstWeight>
+bool run_batch(const CliOptions& options, MstWeight&& mst_weight) {
+    const auto n_workers = resolve_thread_count(options.n_threads);
+
+    // graphs[i], weights[i] and errors[i] -> input, result and error message, empty if it has
+    // been solved, of the i-th graph of the current round
+    std::vector<EdgeList<Label, Weight>> graphs(n_workers);
+    std::vector<Weight> weights(n_workers);
+    std::vector<std::string> errors(n_workers);
+    bool all_solved = true;
+
+    // run task, which reads or solves the i-th graph, on a worker thread, and record in
+    // errors[i] the exception it throws, if any
+    const auto guarded = [&errors](const std::size_t i, auto&& task) {
+        try {
+            task();
+        } catch (const std::exception& e) {
+            errors[i] = e.what();
+        }
+    };
+
+    // compute the MST weight of graphs[i]
+    const auto solve = [&graphs, &weights, &mst_weight](const std::size_t i) {
+        const auto& [n, edges] = graphs[i];
+        weights[i] = mst_weight(Graph(edges.data(), edges.data() + edges.size(), n), 1);
+    };
+
+    // print the result of the i-th graph of the current round after prefix
+    const auto report = [&weights, &errors, &all_solved](const std::string& prefix,
+                                                         const std::size_t i) {
+        std::cout << prefix;
+        if (errors[i].empty()) {
+            std::cout << weights[i] << '\n';
+        } else {
+            std::cout << "error: " << errors[i] << '\n';
+            errors[i].clear();
+            all_solved = false;
+        }
+    };
+
+    // use std::fixed to avoid displaying numbers in scientific notation
+    std::cout << std::fixed;
+
+    if (!options.input_path.empty() && std::filesystem::is_directory(options.input_path)) {
+        const auto paths = detail::batch_input_files(options.input_path);
+
+        for (std::size_t round = 0; round < paths.size(); round += n_workers) {
+            const auto n_graphs = std::min(n_workers, paths.size() - round);
+
+            parallel_for(
+                n_graphs, n_workers,
+                [&](const std::size_t first, const std::size_t last, std::size_t) {
+                    for (auto i = first; i < last; ++i) {
+                        guarded(i, [&]() {
+                            FastScanner scanner(paths[round + i]);
+                            fast_edge_list_read(scanner, graphs[i]);
+                            solve(i);
+                        });
+                    }
+                },
+                1);
+
+            for (std::size_t i = 0; i < n_graphs; ++i) {
+                report(paths[round + i] + ' ', i);
+            }
+        }
+
+        std::cout << std::flush;
+        return all_solved;
+    }
+
+    auto scanner =
+        options.input_path.empty() ? FastScanner(stdin) : FastScanner(options.input_path);
+
+    // a graph that can't be parsed leaves the scanner in the middle of it, and the next graph
+    // can't be found, so the batch stops after the round of that graph
+    bool stream_broken = false;
+    while (!stream_broken && scanner.has_next()) {
+        std::size_t n_graphs = 0;
+        while (n_graphs < n_workers && scanner.has_next()) {
+            const auto i = n_graphs++;
+            guarded(i, [&]() { fast_edge_list_read(scanner, graphs[i]); });
+            if (!errors[i].empty()) {
+                stream_broken = true;
+                break;
+            }
+        }
+
+        parallel_for(
+            n_graphs, n_workers,
+            [&](const std::size_t first, const std::size_t last, std::size_t) {
+                for (auto i = first; i < last; ++i) {
+                    if (errors[i].empty()) {
+                        guarded(i, [&]() { solve(i); });
+                    }
+                }
+            },
+            1);
+
+        for (std::size_t i = 0; i < n_graphs; ++i) {
+            report("", i);
+        }
+    }
+
+    std::cout << std::flush;
+    return all_solved;
+}
+
+#endif  // BATCH_RUNNER_H
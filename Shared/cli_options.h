@@ -0,0 +1,100 @@
+#ifndef CLI_OPTIONS_H
+#define CLI_OPTIONS_H
+
+#include <cstdlib>   // std::exit, std::strtoul
+#include <cstring>   // std::strcmp
+#include <iostream>  // std::cerr
+#include <string>    // std::string
+
+/**
+ * Command-line options shared by every executable in this project.
+ *
+ * Usage: program [--fast-input | --binary] [--batch] [--threads N] [--memory MiB] [input-file]
+ *
+ * --fast-input: parse the input with FastScanner instead of std::cin.
+ * --binary:     the input file is in the binary graph format (see BinaryGraphFile.h) and it is
+ *               memory-mapped. It requires an input file.
+ * --batch:      compute the MST of many graphs, read from a stream of text graphs or from a
+ *               directory of input_random_*.txt files, and print one total weight per graph (see
+ *               run_batch). It can't be combined with --binary.
+ * --threads N:  number of threads used by the parallel algorithms and by the edge sort of the
+ *               Kruskal algorithms, 0 (the default) means one thread for every hardware thread.
+ *               With --batch, number of graphs processed in parallel.
+ * --memory MiB: memory budget of the external algorithms (e.g. KruskalExternal) in MiB, 1024 by
+ *               default.
+ * input-file:   read the graph from the given file instead of stdin. With --fast-input the file
+ *               is memory-mapped.
+ */
+struct CliOptions {
+    // true iff the input must be read with FastScanner
+    bool fast_input = false;
+
+    // true iff the input file is in the binary graph format
+    bool binary_input = false;
+
+    // true iff the input contains many graphs, see run_batch
+    bool batch = false;
+
+    // number of threads of the parallel algorithms, 0 means one for every hardware thread
+    std::size_t n_threads = 0;
+
+    // memory budget of the external algorithms, in bytes
+    std::size_t memory_budget = std::size_t(1024) << 20;
+
+    // path of the input file, empty if the input must be read from stdin
+    std::string input_path;
+};
+
+/**
+ * Parse the command-line arguments. On invalid arguments, print the usage and exit.
+ */
+inline CliOptions parse_cli_options(const int argc, char* argv[]) {
+    CliOptions options;
+
+    const auto usage = [argv]() {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--fast-input | --binary] [--batch] [--threads N] [--memory MiB]"
+                  << " [input-file]" << std::endl;
+        std::exit(1);
+    };
+
+    // parse the value of an option, which must be a non-negative integer and nothing else
+    const auto parse_size = [&usage](const char* value) {
+        char* end = nullptr;
+        const auto size = static_cast<std::size_t>(std::strtoul(value, &end, 10));
+        if (value[0] < '0' || value[0] > '9' || *end != '\0') {
+            usage();
+        }
+        return size;
+    };
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+
+        if (std::strcmp(arg, "--fast-input") == 0) {
+            options.fast_input = true;
+        } else if (std::strcmp(arg, "--binary") == 0) {
+            options.binary_input = true;
+        } else if (std::strcmp(arg, "--batch") == 0) {
+            options.batch = true;
+        } else if (std::strcmp(arg, "--threads") == 0 && i + 1 < argc) {
+            options.n_threads = parse_size(argv[++i]);
+        } else if (std::strcmp(arg, "--memory") == 0 && i + 1 < argc) {
+            options.memory_budget = parse_size(argv[++i]) << 20;
+        } else if (arg[0] != '-' && options.input_path.empty()) {
+            options.input_path = arg;
+        } else {
+            usage();
+        }
+    }
+
+    // a binary graph can only be memory-mapped from a file
+    if (options.binary_input &&
+        (options.fast_input || options.batch || options.input_path.empty())) {
+        usage();
+    }
+
+    return options;
+}
+
+#endif  // CLI_OPTIONS_H
@@ -0,0 +1,42 @@
+#ifndef CSR_GRAPH_FACTORY_H
+#define CSR_GRAPH_FACTORY_H
+
+#include <type_traits>  // std::enable_if, std::is_unsigned, std::is_signed
+
+#include "CSRGraph.h"
+#include "cli_options.h"
+#include "edge_list_factory.h"
+#include "edge_list_loader.h"
+
+/**
+ * Helper that reads a graph from a text file and stores it in a CSRGraph.
+ * The input format and the label conventions are the same of adjacency_map_graph_factory.
+ * Creating a graph representation from an input file takes O(n + m*log(d)) time.
+ *
+ * Label is the type of a node label, which must be an unsigned integer.
+ * Weight is the type of an edge weight, which must be a signed integer.
+ */
+template <typename Label, typename Weight,
+          typename = typename std::enable_if<std::is_unsigned<Label>::value>::type,
+          typename = typename std::enable_if<std::is_signed<Weight>::value>::type>
+CSRGraph<Label, Weight> csr_graph_factory() {
+    auto [n, edge_list] = edge_list_factory<Label, Weight>();
+
+    // after the creation of csr_graph, edge_list is no longer accessible
+    CSRGraph<Label, Weight> csr_graph(std::move(edge_list), n);
+
+    return csr_graph;
+}
+
+/**
+ * Helper that reads a graph with the loader selected by the given command-line options.
+ * See load_graph.
+ */
+template <typename Label, typename Weight,
+          typename = typename std::enable_if<std::is_unsigned<Label>::value>::type,
+          typename = typename std::enable_if<std::is_signed<Weight>::value>::type>
+CSRGraph<Label, Weight> csr_graph_factory(const CliOptions& options) {
+    return load_graph<CSRGraph<Label, Weight>, Label, Weight>(options);
+}
+
+#endif  // CSR_GRAPH_FACTORY_H
@@ -0,0 +1,64 @@
+#ifndef EDGE_LIST_FACTORY_H
+#define EDGE_LIST_FACTORY_H
+
+#include <iostream>     // std::cin, std::istream
+#include <type_traits>  // std::enable_if, std::is_unsigned, std::is_signed
+#include <vector>       // std::vector
+
+#include "Edge.h"
+
+/**
+ * EdgeList is the raw content of an input file: the declared number of vertexes and the
+ * list of weighted edges, before any graph representation is built on top of them.
+ */
+template <typename Label, typename Weight>
+struct EdgeList {
+    size_t n_vertex;
+    std::vector<Edge<Label, Weight>> edges;
+};
+
+/**
+ * Helper that reads the list of edges of a graph from a text stream, stdin by default.
+ * We assume that the nodes are labeled with a label x,
+ * where 1 <= x <= n (n is the number of nodes).
+ * The edges are going to be saved with their labels decremented by 1
+ * (thus 0 <= x' <= n-1), to simplify the book-keeping in the
+ * MST algorithm implementations.
+ * Time:  O(m)
+ * Space: O(m)
+ *
+ * Label is the type of a node label, which must be an unsigned integer.
+ * Weight is the type of an edge weight, which must be a signed integer.
+ */
+template <typename Label, typename Weight,
+          typename = typename std::enable_if<std::is_unsigned<Label>::value>::type,
+          typename = typename std::enable_if<std::is_signed<Weight>::value>::type>
+EdgeList<Label, Weight> edge_list_factory(std::istream& in = std::cin) {
+    size_t n;  // number of vertexes
+    size_t m;  // number of edges
+    in >> n >> m;
+
+    // vector that stores the edges read from the input file
+    std::vector<Edge<Label, Weight>> edge_list;
+    edge_list.reserve(m);
+
+    Label u;
+    Label v;
+    Weight w;
+
+    size_t i = m;
+    while (i > 0) {
+        /**
+         * For each row of the input file, we read a weighted edge.
+         * The edge between u and v weights w.
+         * Time: O(m)
+         */
+        in >> u >> v >> w;
+        edge_list.emplace_back(u - 1, v - 1, w);
+        i--;
+    }
+
+    return {n, std::move(edge_list)};
+}
+
+#endif  // EDGE_LIST_FACTORY_H
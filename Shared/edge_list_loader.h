@@ -0,0 +1,63 @@
+#ifndef EDGE_LIST_LOADER_H
+#define EDGE_LIST_LOADER_H
+
+#include <fstream>    // std::ifstream
+#include <stdexcept>  // std::runtime_error
+
+#include "BinaryGraphFile.h"
+#include "cli_options.h"
+#include "edge_list_factory.h"
+#include "fast_edge_list_factory.h"
+
+/**
+ * Read the list of edges of a graph with the loader selected by the command-line options.
+ * Throws std::runtime_error if the input file can't be opened or isn't a valid binary graph.
+ *
+ * Label is the type of a node label, which must be an unsigned integer.
+ * Weight is the type of an edge weight, which must be a signed integer.
+ */
+template <typename Label, typename Weight>
+EdgeList<Label, Weight> load_edge_list(const CliOptions& options) {
+    if (options.binary_input) {
+        // the edges must outlive the mapping, so they are copied
+        const MappedEdgeList<Label, Weight> mapped(options.input_path);
+        return {mapped.vertexes_size(), {mapped.begin(), mapped.end()}};
+    }
+
+    if (options.fast_input) {
+        return fast_edge_list_factory<Label, Weight>(options.input_path);
+    }
+
+    if (options.input_path.empty()) {
+        return edge_list_factory<Label, Weight>();
+    }
+
+    std::ifstream file(options.input_path);
+    if (!file) {
+        throw std::runtime_error("load_edge_list: cannot open '" + options.input_path + "'");
+    }
+
+    return edge_list_factory<Label, Weight>(file);
+}
+
+/**
+ * Build a graph of type Graph with the loader selected by the command-line options.
+ * Binary graph files are memory-mapped and the graph is built directly from the mapped edges,
+ * without any intermediate copy. Text inputs are parsed with load_edge_list.
+ * Throws std::runtime_error if the input file can't be opened or isn't a valid binary graph.
+ *
+ * Graph must be constructible from an edge vector or from an array of edges, followed by the
+ * number of vertexes, like AdjacencyMapGraph and CSRGraph.
+ */
+template <class Graph, typename Label, typename Weight>
+Graph load_graph(const CliOptions& options) {
+    if (options.binary_input) {
+        const MappedEdgeList<Label, Weight> mapped(options.input_path);
+        return Graph(mapped.begin(), mapped.end(), mapped.vertexes_size());
+    }
+
+    auto [n, edge_list] = load_edge_list<Label, Weight>(options);
+    return Graph(std::move(edge_list), n);
+}
+
+#endif  // EDGE_LIST_LOADER_H
@@ -0,0 +1,62 @@
+#ifndef EDGE_STREAM_H
+#define EDGE_STREAM_H
+
+#include <cstdio>  // stdin
+
+#include "BinaryGraphFile.h"
+#include "Edge.h"
+#include "FastScanner.h"
+#include "cli_options.h"
+#include "fast_edge_list_factory.h"
+
+/**
+ * Stream the edges of the input graph selected by options, without ever storing them all
+ * together: return consume(n, next_edge), where n is the number of vertexes of the graph and
+ * next_edge(Edge<Label, Weight>&) copies the next edge in its argument and returns true, or
+ * returns false when the edges are over. Every edge is read once, in the order of the input.
+ * - Binary graphs (--binary) are read sequentially straight out of their mapping.
+ * - Text graphs are parsed with FastScanner, which reads stdin in blocks or memory-maps the
+ *   input file. See fast_edge_list_read for the input format and the label conventions.
+ * Throws std::runtime_error if the input file can't be opened or isn't a valid graph.
+ */
+template <typename Label, typename Weight, class Consumer>
+auto stream_edges(const CliOptions& options, Consumer&& consume) {
+    if (options.binary_input) {
+        const MappedEdgeList<Label, Weight> mapped(options.input_path);
+        auto it = mapped.begin();
+        const auto next_edge = [&it, last = mapped.end()](Edge<Label, Weight>& edge) {
+            if (it == last) {
+                return false;
+            }
+            edge = *it++;
+            return true;
+        };
+
+        return consume(mapped.vertexes_size(), next_edge);
+    }
+
+    auto scanner =
+        options.input_path.empty() ? FastScanner(stdin) : FastScanner(options.input_path);
+    const auto n = scanner.next<size_t>();  // number of vertexes
+    auto m = scanner.next<size_t>();        // number of edges left to read
+    detail::check_vertexes_size(n);
+
+    const auto next_edge = [&scanner, &m, n](Edge<Label, Weight>& edge) {
+        if (m == 0) {
+            return false;
+        }
+        --m;
+
+        const auto u = scanner.next<Label>();
+        const auto v = scanner.next<Label>();
+        const auto w = scanner.next<Weight>();
+        detail::check_label(u, n);
+        detail::check_label(v, n);
+        edge = Edge<Label, Weight>(u - 1, v - 1, w);
+        return true;
+    };
+
+    return consume(n, next_edge);
+}
+
+#endif  // EDGE_STREAM_H
@@ -0,0 +1,28 @@
+#ifndef EDGE_VECTOR_H
+#define EDGE_VECTOR_H
+
+#include <type_traits>  // std::is_same, std::decay
+#include <vector>       // std::vector
+
+#include "Edge.h"
+
+/**
+ * Return the edges of the given graph in a std::vector that the caller can modify, e.g. to
+ * partition or heapify them in place.
+ * CSRGraph::get_edges() already returns a new std::vector, which is returned as is, while the
+ * edge set of AdjacencyMapGraph is copied.
+ * Time:  O(n + m)
+ * Space: O(m)
+ */
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+[[nodiscard]] std::vector<Edge<Label, Weight>> get_edge_vector(const Graph<Label, Weight>& graph) {
+    if constexpr (std::is_same<typename std::decay<decltype(graph.get_edges())>::type,
+                               std::vector<Edge<Label, Weight>>>::value) {
+        return graph.get_edges();
+    } else {
+        const auto& edges = graph.get_edges();
+        return {edges.cbegin(), edges.cend()};
+    }
+}
+
+#endif  // EDGE_VECTOR_H
@@ -0,0 +1,100 @@
+#ifndef FAST_EDGE_LIST_FACTORY_H
+#define FAST_EDGE_LIST_FACTORY_H
+
+#include <cstdio>       // stdin
+#include <stdexcept>    // std::runtime_error
+#include <string>       // std::string, std::to_string
+#include <type_traits>  // std::enable_if, std::is_unsigned, std::is_signed
+#include <vector>       // std::vector
+
+#include "Edge.h"
+#include "FastScanner.h"
+#include "edge_list_factory.h"
+
+namespace detail {
+
+    // throw std::runtime_error unless the graph has at least one vertex
+    inline void check_vertexes_size(const size_t n) {
+        if (n == 0) {
+            throw std::runtime_error("invalid graph: it has no vertexes");
+        }
+    }
+
+    // throw std::runtime_error unless label, which is 1-based, is a vertex of a graph with n
+    // vertexes. A missing label, because the input is over, is read as 0
+    template <typename Label>
+    void check_label(const Label label, const size_t n) {
+        if (label == 0 || label > n) {
+            throw std::runtime_error("invalid graph: label " + std::to_string(label) +
+                                     " is out of range [1, " + std::to_string(n) + "]");
+        }
+    }
+
+}  // namespace detail
+
+/**
+ * Helper that reads the next graph from the given FastScanner into edge_list, overwriting it.
+ * The memory already allocated by edge_list is reused, so reading many graphs into the same
+ * EdgeList allocates memory only when a graph has more edges than all the previous ones.
+ * The input format and the label conventions are the same of edge_list_factory, but the
+ * integers are parsed directly into the edge vector, bypassing iostreams entirely.
+ * Throws std::runtime_error if the graph has no vertexes, or if a label is out of range or
+ * missing.
+ * Time:  O(m)
+ * Space: O(m)
+ *
+ * Label is the type of a node label, which must be an unsigned integer.
+ * Weight is the type of an edge weight, which must be a signed integer.
+ */
+template <typename Label, typename Weight,
+          typename = typename std::enable_if<std::is_unsigned<Label>::value>::type,
+          typename = typename std::enable_if<std::is_signed<Weight>::value>::type>
+void fast_edge_list_read(FastScanner& scanner, EdgeList<Label, Weight>& edge_list) {
+    const auto n = scanner.next<size_t>();  // number of vertexes
+    const auto m = scanner.next<size_t>();  // number of edges
+    detail::check_vertexes_size(n);
+
+    edge_list.n_vertex = n;
+    auto& edges = edge_list.edges;
+    edges.clear();
+    edges.reserve(m);
+
+    for (size_t i = 0; i < m; ++i) {
+        // the evaluation order of function arguments is unspecified, so u, v and w must be
+        // read in separate statements
+        const auto u = scanner.next<Label>();
+        const auto v = scanner.next<Label>();
+        const auto w = scanner.next<Weight>();
+        detail::check_label(u, n);
+        detail::check_label(v, n);
+        edges.emplace_back(u - 1, v - 1, w);
+    }
+}
+
+/**
+ * Helper that reads the list of edges of a graph with the given FastScanner.
+ * See fast_edge_list_read.
+ */
+template <typename Label, typename Weight>
+EdgeList<Label, Weight> fast_edge_list_factory(FastScanner& scanner) {
+    EdgeList<Label, Weight> edge_list;
+    fast_edge_list_read(scanner, edge_list);
+    return edge_list;
+}
+
+/**
+ * Helper that reads the list of edges of a graph from the file at the given path, which is
+ * memory-mapped, or from stdin in large blocks if the path is empty.
+ */
+template <typename Label, typename Weight>
+EdgeList<Label, Weight> fast_edge_list_factory(const std::string& path = "") {
+    if (path.empty()) {
+        FastScanner scanner(stdin);
+        return fast_edge_list_factory<Label, Weight>(scanner);
+    }
+
+    FastScanner scanner(path);
+    return fast_edge_list_factory<Label, Weight>(scanner);
+}
+
+#endif  // FAST_EDGE_LIST_FACTORY_H
@@ -0,0 +1,54 @@
+#ifndef FILTER_KRUSKAL_H
+#define FILTER_KRUSKAL_H
+
+#include <algorithm>   // std::min, std::max
+#include <functional>  // std::less
+#include <iterator>    // std::distance
+#include <vector>      // std::vector
+
+#include "Edge.h"
+#include "sort_by_weight.h"
+
+// building blocks shared by the serial and the parallel Filter-Kruskal algorithms
+namespace detail {
+
+    // ranges of edges that are never partitioned, even if they are shorter than the number of
+    // vertexes
+    constexpr std::size_t filter_kruskal_min_partition = 1024;
+
+    // return the maximum number of edges of a range that is sorted instead of being partitioned.
+    // Partitioning pays off only while there are many more edges than vertexes, because then
+    // most of the heavy edges can be filtered out. Sparse graphs are sorted right away
+    [[nodiscard]] inline std::size_t filter_kruskal_threshold(const std::size_t n) noexcept {
+        return std::max(filter_kruskal_min_partition, n);
+    }
+
+    // return the median of the weights of the first, middle and last edge of [first, last)
+    template <typename Weight, class It>
+    [[nodiscard]] Weight median_of_three_weight(It first, It last) noexcept {
+        const Weight a = first->weight;
+        const Weight b = (first + std::distance(first, last) / 2)->weight;
+        const Weight c = (last - 1)->weight;
+        return std::max(std::min(a, b), std::min(std::max(a, b), c));
+    }
+
+    // classic Kruskal on the edges in [first, last), which are sorted first on n_threads threads
+    template <typename Label, typename Weight, class It, class DisjointSet>
+    void kruskal_range(It first, It last, DisjointSet& disjoint_set,
+                       std::vector<Edge<Label, Weight>>& mst, const std::size_t n_stop,
+                       const std::size_t n_threads = 1) {
+        sort_by_weight(first, last, std::less<>{}, n_threads);
+
+        for (auto it = first; it != last && mst.size() < n_stop; ++it) {
+            const auto& [v, w, _] = *it;
+
+            // O(log*(n)) ~ O(1), the roots of v and w are found once
+            if (disjoint_set.try_unite(v, w)) {
+                mst.push_back(*it);
+            }
+        }
+    }
+
+}  // namespace detail
+
+#endif  // FILTER_KRUSKAL_H
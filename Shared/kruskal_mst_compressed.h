@@ -4,22 +4,24 @@
 #include <functional>  // std::less
 #include <vector>      // std::vector
 
-#include "AdjacencyMapGraph.h"
 #include "DisjointSetCompressed.h"
+#include "Edge.h"
 
-template <typename Label, typename Weight>
-auto kruskal_mst_compressed(AdjacencyMapGraph<Label, Weight>&& adj_map_graph) noexcept
+template <typename Label, typename Weight, template <typename, typename> class Graph>
+auto kruskal_mst_compressed(Graph<Label, Weight>&& graph,
+                            const std::size_t n_threads = 1) noexcept
     -> std::vector<Edge<Label, Weight>> {
     // this vector will store the Minimum Spanning Tree
     std::vector<Edge<Label, Weight>> mst;
-    const size_t n_stop = adj_map_graph.vertexes_size() - 1;
+    const size_t n_stop = graph.vertexes_size() - 1;
     mst.reserve(n_stop);
 
-    // sort edges in non-decreasing order of weight in O(mlogm) time
-    auto edges = adj_map_graph.get_sorted_edges(std::less<>{});
+    // sort edges in non-decreasing order of weight in O(m) time with a radix sort, which is
+    // split among n_threads threads
+    auto edges = graph.get_sorted_edges(std::less<>{}, n_threads);
 
     // generate vector of vertexes in O(n) time
-    auto vertexes = adj_map_graph.get_vertexes();
+    auto vertexes = graph.get_vertexes();
 
     /**
      * Create a new Disjoint-Set data structure to store the vertexes.
@@ -30,14 +32,13 @@ auto kruskal_mst_compressed(AdjacencyMapGraph<Label, Weight>&& adj_map_graph) no
 
     // a Minimum Spanning Tree can have (n - 1) edges at maximum.
     // The mst is populated in O(mlog*(n)) time
-    for (auto it = edges.cbegin(); !(it == edges.cend() && n_stop == mst.size()); ++it) {
+    for (auto it = edges.cbegin(); it != edges.cend() && mst.size() < n_stop; ++it) {
         const auto& edge = *it;
         const auto& [v, w, _] = edge;
 
-        // O(log*(n)) ~ O(1)
-        if (!disjoint_set.are_connected(v, w)) {
+        // O(log*(n)) ~ O(1), the roots of v and w are found once
+        if (disjoint_set.try_unite(v, w)) {
             mst.push_back(edge);
-            disjoint_set.unite(v, w);
         }
     }
 
@@ -0,0 +1,68 @@
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include <algorithm>  // std::min
+#include <thread>     // std::thread
+#include <utility>    // std::forward
+#include <vector>     // std::vector
+
+/**
+ * Return the number of threads to use when n_threads are requested: 0 means one thread for
+ * every hardware thread.
+ */
+[[nodiscard]] inline std::size_t resolve_thread_count(const std::size_t n_threads) noexcept {
+    if (n_threads > 0) {
+        return n_threads;
+    }
+
+    const auto hardware_threads = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    return hardware_threads > 0 ? hardware_threads : 1;
+}
+
+// ranges shorter than this are processed by the calling thread only, because spawning threads
+// would cost more than the work itself
+constexpr std::size_t parallel_for_min_chunk = 4096;
+
+/**
+ * Split [0, n) in at most n_threads contiguous chunks of similar size, and call
+ * fn(first, last, chunk) for every chunk [first, last) on a separate thread. The first chunk is
+ * processed by the calling thread. It returns when every chunk has been processed.
+ * Every chunk has at least min_chunk elements, which should be lowered when every element is
+ * expensive to process, e.g. a whole graph.
+ * n_threads must have already been resolved with resolve_thread_count.
+ * Return the number of chunks, which fn can use to size per-chunk data.
+ */
+template <class Fn>
+std::size_t parallel_for(const std::size_t n, const std::size_t n_threads, Fn&& fn,
+                         const std::size_t min_chunk = parallel_for_min_chunk) {
+    const std::size_t n_chunks =
+        std::max<std::size_t>(1, std::min(n_threads, n / std::max<std::size_t>(1, min_chunk)));
+
+    if (n_chunks == 1) {
+        fn(std::size_t(0), n, std::size_t(0));
+        return 1;
+    }
+
+    // index of the first element of the given chunk
+    const auto chunk_first = [n, n_chunks](const std::size_t chunk) {
+        return n * chunk / n_chunks;
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(n_chunks - 1);
+    for (std::size_t chunk = 1; chunk < n_chunks; ++chunk) {
+        workers.emplace_back([&fn, &chunk_first, chunk]() {
+            fn(chunk_first(chunk), chunk_first(chunk + 1), chunk);
+        });
+    }
+
+    fn(std::size_t(0), chunk_first(1), std::size_t(0));
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    return n_chunks;
+}
+
+#endif  // PARALLEL_FOR_H
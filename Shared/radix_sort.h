@@ -0,0 +1,241 @@
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <algorithm>    // std::move, std::min, std::max
+#include <array>        // std::array
+#include <functional>   // std::less, std::greater
+#include <iterator>     // std::distance, std::iterator_traits
+#include <type_traits>  // std::decay, std::is_integral, std::make_unsigned
+#include <utility>      // std::forward, std::pair
+#include <vector>       // std::vector
+
+#include "parallel_for.h"
+
+namespace radix_sort {
+
+    namespace detail {
+        // order<Comparator, Key>::supported is true iff Comparator orders keys of type Key like
+        // std::less or std::greater, i.e. the order that radix sort can reproduce.
+        template <class Comparator, typename Key>
+        struct order {
+            static constexpr bool supported = false;
+            static constexpr bool descending = false;
+        };
+
+        template <typename Key>
+        struct order<std::less<>, Key> {
+            static constexpr bool supported = true;
+            static constexpr bool descending = false;
+        };
+
+        template <typename Key>
+        struct order<std::less<Key>, Key> : order<std::less<>, Key> {};
+
+        template <typename Key>
+        struct order<std::greater<>, Key> {
+            static constexpr bool supported = true;
+            static constexpr bool descending = true;
+        };
+
+        template <typename Key>
+        struct order<std::greater<Key>, Key> : order<std::greater<>, Key> {};
+
+        // number of bits sorted by every pass
+        constexpr std::size_t digit_bits = 8;
+
+        // number of buckets of every pass
+        constexpr std::size_t radix = std::size_t(1) << digit_bits;
+    }  // namespace detail
+
+    // ranges shorter than this are always sorted by a single thread
+    constexpr std::size_t parallel_min_size = std::size_t(1) << 16;
+
+    // true iff sort_by_key can replace a comparison sort that applies Comparator to keys of
+    // type Key
+    template <class Comparator, typename Key>
+    constexpr bool is_supported_v =
+        std::is_integral<Key>::value &&
+        detail::order<typename std::decay<Comparator>::type, Key>::supported;
+
+    /**
+     * Sort the values in the random access range [first, last) by the integral key returned by
+     * key(value), in the order defined by Comparator, which must be std::less or std::greater
+     * (see is_supported_v).
+     * Every key is mapped to its unsigned distance from the smallest key (from the biggest key
+     * in descending order), which has the same order of the key even for negative signed keys.
+     * The distances are then sorted with a stable least-significant-digit radix sort, one byte
+     * per pass, skipping the high bytes which are zero for every distance: e.g. weights in
+     * [-9999, 9999] are sorted in 2 passes.
+     * With n_threads > 1 (0 means one thread for every hardware thread) and at least
+     * parallel_min_size values, the range is split in contiguous chunks, one per thread. Every
+     * chunk counts its own digits, and it scatters its values to the positions that follow the
+     * ones of the same bucket in the previous chunks, so the sort is still stable.
+     * Time:  O(m*sizeof(Key)/p) with p threads
+     * Space: O(m + p*sizeof(Key)*256)
+     */
+    template <class Comparator, class It, class KeyFn>
+    void sort_by_key(const It first, const It last, KeyFn&& key, const std::size_t n_threads = 1) {
+        using T = typename std::iterator_traits<It>::value_type;
+        using key_t = typename std::decay<decltype(key(*first))>::type;
+        using unsigned_t = typename std::make_unsigned<key_t>::type;
+        using order_t = detail::order<typename std::decay<Comparator>::type, key_t>;
+        using count_t = std::array<std::size_t, detail::radix>;
+
+        static_assert(is_supported_v<Comparator, key_t>,
+                      "radix_sort::sort_by_key requires an integral key and std::less or "
+                      "std::greater");
+
+        const auto n = static_cast<std::size_t>(std::distance(first, last));
+        if (n < 2) {
+            return;
+        }
+
+        // small ranges are sorted by the calling thread only
+        const std::size_t threads = n < parallel_min_size ? 1 : resolve_thread_count(n_threads);
+
+        // find the range of the keys of every chunk, then of all the keys
+        std::vector<std::pair<key_t, key_t>> key_ranges(threads);
+        const auto n_chunks = parallel_for(n, threads, [&](const std::size_t chunk_first,
+                                                           const std::size_t chunk_last,
+                                                           const std::size_t chunk) {
+            key_t min_key = key(first[chunk_first]);
+            key_t max_key = min_key;
+            for (auto i = chunk_first; i < chunk_last; ++i) {
+                const key_t k = key(first[i]);
+                min_key = k < min_key ? k : min_key;
+                max_key = k > max_key ? k : max_key;
+            }
+            key_ranges[chunk] = {min_key, max_key};
+        });
+
+        auto [min_key, max_key] = key_ranges[0];
+        for (std::size_t chunk = 1; chunk < n_chunks; ++chunk) {
+            min_key = std::min(min_key, key_ranges[chunk].first);
+            max_key = std::max(max_key, key_ranges[chunk].second);
+        }
+
+        // map a key to an unsigned integer that sorts in ascending order like the key sorts
+        // according to Comparator. Unsigned arithmetic can't overflow here.
+        const auto distance = [&key, min_key = min_key, max_key = max_key](const T& value) {
+            if constexpr (order_t::descending) {
+                return static_cast<unsigned_t>(static_cast<unsigned_t>(max_key) -
+                                               static_cast<unsigned_t>(key(value)));
+            } else {
+                return static_cast<unsigned_t>(static_cast<unsigned_t>(key(value)) -
+                                               static_cast<unsigned_t>(min_key));
+            }
+        };
+
+        // number of bytes needed to represent the biggest distance
+        std::size_t n_digits = 0;
+        for (auto range = static_cast<unsigned_t>(static_cast<unsigned_t>(max_key) -
+                                                  static_cast<unsigned_t>(min_key));
+             range > 0; range = static_cast<unsigned_t>(range >> detail::digit_bits)) {
+            ++n_digits;
+        }
+
+        const auto digit = [](const unsigned_t u, const std::size_t d) -> std::size_t {
+            return static_cast<std::size_t>(u >> (d * detail::digit_bits)) & (detail::radix - 1);
+        };
+
+        // counts[chunk][d] -> occurrences of every digit d in the chunk, counted in a single pass
+        std::vector<std::vector<count_t>> counts(n_chunks, std::vector<count_t>(n_digits));
+        parallel_for(n, threads, [&](const std::size_t chunk_first, const std::size_t chunk_last,
+                                     const std::size_t chunk) {
+            auto& chunk_counts = counts[chunk];
+            for (auto& count : chunk_counts) {
+                count.fill(0);
+            }
+
+            for (auto i = chunk_first; i < chunk_last; ++i) {
+                const auto u = distance(first[i]);
+                for (std::size_t d = 0; d < n_digits; ++d) {
+                    ++chunk_counts[d][digit(u, d)];
+                }
+            }
+        });
+
+        // every pass moves the values to other chunks, so with more than one chunk the digits
+        // of every chunk must be counted again before each pass but the first
+        const auto recount = [&](const auto source, const std::size_t d) {
+            parallel_for(n, threads, [&](const std::size_t chunk_first,
+                                         const std::size_t chunk_last, const std::size_t chunk) {
+                auto& count = counts[chunk][d];
+                count.fill(0);
+                for (auto i = chunk_first; i < chunk_last; ++i) {
+                    ++count[digit(distance(source[i]), d)];
+                }
+            });
+        };
+
+        // stable scatter of the values of every chunk from source into destination
+        const auto scatter = [&](const auto source, const auto destination, const std::size_t d) {
+            parallel_for(n, threads, [&](const std::size_t chunk_first,
+                                         const std::size_t chunk_last, const std::size_t chunk) {
+                auto& count = counts[chunk][d];
+                for (auto i = chunk_first; i < chunk_last; ++i) {
+                    destination[count[digit(distance(source[i]), d)]++] = std::move(source[i]);
+                }
+            });
+        };
+
+        // the passes move the values back and forth between [first, last) and buffer
+        std::vector<T> buffer(n);
+        bool in_buffer = false;
+        for (std::size_t d = 0; d < n_digits; ++d) {
+            // every key has the same digit, this pass wouldn't move anything
+            const auto first_digit = digit(distance(in_buffer ? buffer[0] : *first), d);
+            std::size_t first_digit_count = 0;
+            for (const auto& chunk_counts : counts) {
+                first_digit_count += chunk_counts[d][first_digit];
+            }
+            if (first_digit_count == n) {
+                continue;
+            }
+
+            if (n_chunks > 1 && d > 0) {
+                if (in_buffer) {
+                    recount(buffer.begin(), d);
+                } else {
+                    recount(first, d);
+                }
+            }
+
+            // turn the counts into the index of the first value of every bucket in every chunk:
+            // the values of a chunk follow the ones of the same bucket in the previous chunks
+            std::size_t offset = 0;
+            for (std::size_t bucket = 0; bucket < detail::radix; ++bucket) {
+                for (auto& chunk_counts : counts) {
+                    const auto bucket_size = chunk_counts[d][bucket];
+                    chunk_counts[d][bucket] = offset;
+                    offset += bucket_size;
+                }
+            }
+
+            if (in_buffer) {
+                scatter(buffer.begin(), first, d);
+            } else {
+                scatter(first, buffer.begin(), d);
+            }
+            in_buffer = !in_buffer;
+        }
+
+        if (in_buffer) {
+            parallel_for(n, threads, [&](const std::size_t chunk_first,
+                                         const std::size_t chunk_last, std::size_t) {
+                std::move(buffer.begin() + chunk_first, buffer.begin() + chunk_last,
+                          first + chunk_first);
+            });
+        }
+    }
+
+    // sort values by the integral key returned by key(value), see sort_by_key(first, last, key)
+    template <class Comparator, typename T, class KeyFn>
+    void sort_by_key(std::vector<T>& values, KeyFn&& key, const std::size_t n_threads = 1) {
+        sort_by_key<Comparator>(values.begin(), values.end(), std::forward<KeyFn>(key),
+                                n_threads);
+    }
+
+}  // namespace radix_sort
+
+#endif  // RADIX_SORT_H
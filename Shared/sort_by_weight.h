@@ -0,0 +1,48 @@
+#ifndef SORT_BY_WEIGHT_H
+#define SORT_BY_WEIGHT_H
+
+#include <algorithm>  // std::sort
+#include <cstddef>    // std::size_t
+#include <utility>    // std::forward
+#include <vector>     // std::vector
+
+#include "Edge.h"
+#include "radix_sort.h"
+
+/**
+ * Sort the edges in the random access range [first, last) by weight according to the given
+ * comparator.
+ * If Weight is an integral type and the comparator is std::less or std::greater, the edges are
+ * sorted with radix_sort::sort_by_key on n_threads threads (0 means one thread for every hardware
+ * thread), otherwise std::sort is used on a single thread.
+ * Time:  O(m/p) with p threads if the radix sort is used, O(mlogm) otherwise
+ * Space: O(m) if the radix sort is used, O(logm) otherwise
+ */
+template <class It, class Comparator>
+void sort_by_weight(const It first, const It last, Comparator&& comparator,
+                    const std::size_t n_threads = 1) {
+    using weight_t = decltype(first->weight);
+
+    if constexpr (radix_sort::is_supported_v<Comparator, weight_t>) {
+        radix_sort::sort_by_key<Comparator>(
+            first, last, [](const auto& edge) { return edge.weight; }, n_threads);
+    } else {
+        // sort the edges applying the comparator to the internal weights
+        std::sort(first, last,
+                  [comp{std::forward<Comparator>(comparator)}](const auto& l, const auto& r) {
+                      return comp(l.weight, r.weight);
+                  });
+    }
+}
+
+/**
+ * Sort the given edges by weight according to the given comparator.
+ * See sort_by_weight(first, last, comparator).
+ */
+template <typename Label, typename Weight, class Comparator>
+void sort_by_weight(std::vector<Edge<Label, Weight>>& edges, Comparator&& comparator,
+                    const std::size_t n_threads = 1) {
+    sort_by_weight(edges.begin(), edges.end(), std::forward<Comparator>(comparator), n_threads);
+}
+
+#endif  // SORT_BY_WEIGHT_H
@@ -0,0 +1,39 @@
+#include <iostream>  // std::cout, std::cerr
+
+#include "cli_options.h"
+#include "edge_stream.h"
+#include "streaming_mst.h"
+#include "sum_weights.h"
+
+int main(int argc, char* argv[]) {
+    typedef size_t Label;  // nodes are identified by size_t type
+    typedef long Weight;   // weights are of type long
+
+    // select how the input graph is loaded and the number of threads
+    const auto options = parse_cli_options(argc, argv);
+
+    // the edges are streamed from the input instead of being loaded in a graph, so a batch of
+    // graphs can't be read
+    if (options.batch) {
+        std::cerr << argv[0] << ": --batch is not supported" << std::endl;
+        return 1;
+    }
+
+    try {
+        // the buffer holds as many edges as the vertexes, so memory stays O(n) however long the
+        // stream of edges is
+        const auto bounded_mst = [&options](const std::size_t n, auto&& next_edge) {
+            return streaming_mst<Label, Weight>(n, next_edge, n, options.n_threads);
+        };
+        const auto mst = stream_edges<Label, Weight>(options, bounded_mst);
+
+        // total weight of the mst
+        const auto total_weight = sum_weights<Label, Weight>(mst.cbegin(), mst.cend());
+
+        // use std::fixed to avoid displaying numbers in scientific notation
+        std::cout << std::fixed << total_weight << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef STREAMING_MST_H
+#define STREAMING_MST_H
+
+#include <algorithm>  // std::max
+#include <vector>     // std::vector
+
+#include "CSRGraph.h"
+#include "Edge.h"
+#include "kruskal_mst_compressed.h"
+
+/**
+ * Minimum Spanning Tree of a stream of edges of arbitrary length, in memory bounded by the number
+ * of vertexes instead of the number of edges.
+ * A forest of at most n - 1 edges is kept together with a buffer of the next buffer_size edges of
+ * the stream. When the buffer is full, the MST of forest ∪ buffer is computed with
+ * kruskal_mst_compressed on n_threads threads and becomes the new forest, and the buffer is
+ * emptied. The discarded edges are never needed again: each of them is the heaviest edge of a
+ * cycle of the graph read so far, so by the cycle property it isn't in the MST of any graph that
+ * contains that cycle. When the stream is over, the forest is the exact MST.
+ * With buffer_size = O(n) every compaction takes O(n) time, so the amortized cost of an edge is
+ * O(n / buffer_size) = O(1).
+ * Time:  O(m + m/b * (n + b)), where b is buffer_size
+ * Space: O(n + b)
+ *
+ * next_edge(Edge<Label, Weight>&) must copy the next edge of the stream in its argument and
+ * return true, or return false when the edges are over.
+ */
+template <typename Label, typename Weight, class EdgeSource>
+auto streaming_mst(const std::size_t n, EdgeSource&& next_edge, std::size_t buffer_size,
+                   const std::size_t n_threads = 1) -> std::vector<Edge<Label, Weight>> {
+    buffer_size = std::max<std::size_t>(buffer_size, 1);
+
+    // edges[0, forest_size) -> current forest, edges[forest_size, edges.size()) -> buffer
+    std::vector<Edge<Label, Weight>> edges;
+    std::size_t forest_size = 0;
+    edges.reserve((n > 0 ? n - 1 : 0) + buffer_size);
+
+    // replace forest ∪ buffer with its MST, reusing the memory of edges
+    const auto compact = [&]() {
+        CSRGraph<Label, Weight> graph(edges.data(), edges.data() + edges.size(), n);
+        const auto forest = kruskal_mst_compressed(std::move(graph), n_threads);
+        edges.assign(forest.cbegin(), forest.cend());
+        forest_size = edges.size();
+    };
+
+    Edge<Label, Weight> edge;
+    while (next_edge(edge)) {
+        edges.push_back(edge);
+        if (edges.size() - forest_size == buffer_size) {
+            compact();
+        }
+    }
+
+    if (edges.size() > forest_size) {
+        compact();
+    }
+
+    return edges;
+}
+
+#endif  // STREAMING_MST_H
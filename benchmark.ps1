@@ -1,7 +1,7 @@
 # Usage: ./benchmark.ps1 {dataset-folder}
 
 $exe_folder = ".\x64\Release"
-$programs = "PrimBinaryHeap","PrimKHeap","KruskalUnionFind","KruskalUnionFindCompressed","KruskalNaive"
+$programs = "PrimBinaryHeap","PrimKHeap","PrimLazyBinaryHeap","PrimPairingHeap","PrimFibonacciHeap","KruskalUnionFind","KruskalUnionFindCompressed","KruskalFilter","KruskalBinaryHeap","BoruvkaParallel","KruskalFilterParallel","KruskalLinkCut","IncrementalMST","DynamicMST","KruskalExternal","StreamingMST","KruskalNaive"
 $output_folder = ".\benchmark"
 
 $datasets = "datasets"
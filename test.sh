@@ -2,13 +2,15 @@
 
 set -eu
 
-# Usage: ./test.sh [program-name] > output.csv
+# Usage: ./test.sh [program-name] [max-vertexes] > output.csv
 # Execute [program-name] against all the input files in test/ and compares the result
-# of the program with the corresponding output file
+# of the program with the corresponding output file.
+# If [max-vertexes] is given, the input files with more vertexes are skipped.
 
 # Note: this file needs the LF line endings.
 
 program=$1
+max_vertexes=${2:-}
 test_dir=test
 
 test_no=0
@@ -16,6 +18,13 @@ failed_no=0
 success_no=0
 
 for test_file in ${test_dir}/input_random*.txt; do
+	# input files are named input_random_[id]_[vertexes].txt
+	vertexes=$(basename ${test_file} .txt)
+	vertexes=${vertexes##*_}
+	if [ -n "${max_vertexes}" ] && [ ${vertexes} -gt ${max_vertexes} ]; then
+		continue
+	fi
+
 	test_no=$((test_no+1))
 
 	input_file="${test_file}"
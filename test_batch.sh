@@ -0,0 +1,80 @@
+#!/bin/bash
+
+set -u
+
+# Usage: ./test_batch.sh [program-name] [max-vertexes]
+# Execute [program-name] --batch on a stream of the input files in test/, on the directory test/,
+# and on a stream with a malformed graph in the middle, and compare the results with the
+# corresponding output files.
+# If [max-vertexes] is given, the input files with more vertexes are left out of the stream.
+
+# Note: this file needs the LF line endings.
+
+program=$1
+max_vertexes=${2:-}
+test_dir=test
+threads=4
+
+test_no=0
+failed_no=0
+success_no=0
+
+check() {
+	test_no=$((test_no+1))
+	if [ "$2" == "$3" ]; then
+		success_no=$((success_no+1))
+		echo "OK $1"
+	else
+		failed_no=$((failed_no+1))
+		echo "Mismatch on $1. Got:"
+		echo "$3"
+		echo "Expected:"
+		echo "$2"
+	fi
+}
+
+stream=$(mktemp)
+trap 'rm -f ${stream}' EXIT
+
+# every graph of the stream in the order of test.sh, and their total weights
+expected=""
+for test_file in ${test_dir}/input_random*.txt; do
+	vertexes=$(basename ${test_file} .txt)
+	vertexes=${vertexes##*_}
+	if [ -n "${max_vertexes}" ] && [ ${vertexes} -gt ${max_vertexes} ]; then
+		continue
+	fi
+
+	cat ${test_file} >> ${stream}
+	expected="${expected}$(cat ${test_file/input/output})"$'\n'
+done
+
+actual=$(./${program} --batch --threads ${threads} < ${stream})
+check "the stream of ${test_dir}" "${expected%$'\n'}" "${actual}"
+
+# every line of a directory starts with the path of its file
+expected=""
+for test_file in ${test_dir}/input_random*.txt; do
+	expected="${expected}${test_file} $(cat ${test_file/input/output})"$'\n'
+done
+actual=$(./${program} --batch --threads ${threads} ${test_dir} | sort)
+check "the directory ${test_dir}" "$(echo -n "${expected}" | sort)" "${actual}"
+
+# a malformed graph can't be skipped in a stream: the graphs before it are still solved, then the
+# batch ends with an error
+first=${test_dir}/input_random_1_10.txt
+last=${test_dir}/input_random_2_10.txt
+actual=$( (cat ${first}; printf '3 2\n1 2 5\n9 3 1\n'; cat ${last}) |
+	./${program} --batch --threads ${threads}; echo "exit status $?")
+expected="$(cat ${first/input/output})
+error: invalid graph: label 9 is out of range [1, 3]
+exit status 1"
+check "a stream with a malformed graph" "${expected}" "${actual}"
+
+echo ""
+echo "Executed ${test_no} tests, ${success_no} succeeded and ${failed_no} failed."
+if [ ${failed_no} -eq 0 ]; then
+	exit 0
+else
+	exit 1
+fi
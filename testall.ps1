@@ -1,7 +1,7 @@
 # Usage: ./testall.ps1
 
 $exe_folder = ".\x64\Release"
-$programs = "PrimBinaryHeap","PrimKHeap","KruskalUnionFind","KruskalUnionFindCompressed","KruskalNaive"
+$programs = "PrimBinaryHeap","PrimKHeap","PrimLazyBinaryHeap","PrimPairingHeap","PrimFibonacciHeap","KruskalUnionFind","KruskalUnionFindCompressed","KruskalFilter","KruskalBinaryHeap","BoruvkaParallel","KruskalFilterParallel","KruskalLinkCut","IncrementalMST","DynamicMST","KruskalExternal","StreamingMST","KruskalNaive"
 
 foreach ($program in $programs) {
   echo "Testing $program"
@@ -9,6 +9,11 @@ foreach ($program in $programs) {
   echo ""
 }
 
+# every linking and compression rule of the Disjoint-Sets against a brute-force partition
+echo "Testing DisjointSetTest"
+& "$exe_folder\DisjointSetTest"
+echo ""
+
 # Run tests in parallel
 # $programs | ForEach-Object {
 #   Start-Job -Init ([ScriptBlock]::Create("Set-Location '$pwd'")) -FilePath .\test.ps1 -ArgumentList "$exe_folder\$program"
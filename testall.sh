@@ -1,16 +1,23 @@
 # Usage: ./testall.sh
 
 test_script="test.sh"
-programs="KruskalUnionFind.out KruskalUnionFindCompressed.out PrimBinaryHeap.out"
+programs="KruskalUnionFind.out KruskalUnionFindCompressed.out PrimBinaryHeap.out PrimLazyBinaryHeap.out PrimPairingHeap.out PrimFibonacciHeap.out KruskalFilter.out KruskalBinaryHeap.out BoruvkaParallel.out KruskalFilterParallel.out KruskalLinkCut.out IncrementalMST.out DynamicMST.out KruskalExternal.out StreamingMST.out"
 
-# TODO: KruskalNaive.out is excluded from programs list due to its execution time.
+# KruskalNaive.out takes O(m*n) time, so it's tested only on inputs with up to 10000 vertexes
+naive_program="KruskalNaive.out"
+naive_max_vertexes=10000
+
+disjoint_set_test="DisjointSetTest.out"
+
+# --batch is shared by every algorithm, so it's tested on one of them
+batch_test_script="test_batch.sh"
+batch_program="KruskalUnionFindCompressed.out"
 
 failed_no=0
 
 for program in ${programs}; do
   	printf "Testing ${program} ...  "
-	p=$(./${test_script} ${program})
-	if [ p ]; then
+	if ./${test_script} ${program} > /dev/null; then
 		echo "OK"
 	else
 		failed_no=$((failed_no+1))
@@ -18,9 +25,35 @@ for program in ${programs}; do
 	fi
 done
 
+# every linking and compression rule of the Disjoint-Sets against a brute-force partition
+printf "Testing ${disjoint_set_test} ...  "
+if ./${disjoint_set_test} > /dev/null; then
+	echo "OK"
+else
+	failed_no=$((failed_no+1))
+	echo "FAILED"
+fi
+
+printf "Testing ${naive_program} ...  "
+if ./${test_script} ${naive_program} ${naive_max_vertexes} > /dev/null; then
+	echo "OK"
+else
+	failed_no=$((failed_no+1))
+	echo "FAILED"
+fi
+
+printf "Testing ${batch_program} --batch ...  "
+if ./${batch_test_script} ${batch_program} > /dev/null; then
+	echo "OK"
+else
+	failed_no=$((failed_no+1))
+	echo "FAILED"
+fi
+
 if [ ${failed_no} -eq 0 ]; then
 	echo "All test passed."
 	exit 0
 else
 	echo "There are failures."
+	exit 1
 fi